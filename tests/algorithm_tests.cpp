@@ -22,11 +22,17 @@
 
 #include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHE...
 
-#include <gsl/gsl_algorithm> // for copy
+#include <gsl/gsl_algorithm> // for copy, bitwise_xor, search, byte_searcher...
+#include <gsl/gsl_byte>      // for byte, to_byte, to_integer
 #include <gsl/span>          // for span
 
-#include <array>   // for array
-#include <cstddef> // for size_t
+#include <algorithm> // for search, copy, lower_bound, upper_bound, set_union...
+#include <array>     // for array
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t, uint64_t
+#include <iterator>  // for back_inserter
+#include <string>    // for string
+#include <vector>    // for vector
 
 namespace gsl {
 struct fail_fast;
@@ -219,3 +225,364 @@ TEST_CASE("small_destination_span")
     copy(src_span_static, dst_span_static);
 #endif
 }
+
+TEST_CASE("for_each")
+{
+    std::array<int, 5> arr{1, 2, 3, 4, 5};
+
+    for_each(span<int>(arr), [](int& x) { x *= 2; });
+    CHECK((arr == std::array<int, 5>{2, 4, 6, 8, 10}));
+
+    int sum = 0;
+    for_each(span<const int, 5>(arr), [&sum](int x) { sum += x; });
+    CHECK(sum == 30);
+
+    int calls = 0;
+    for_each(span<int>(), [&calls](int) { ++calls; });
+    CHECK(calls == 0);
+}
+
+TEST_CASE("transform")
+{
+    // unary
+    {
+        const std::array<int, 4> src{1, 2, 3, 4};
+        std::array<long, 6> dst{};
+
+        const auto written = gsl::transform(span<const int>(src), span<long>(dst),
+                                            [](int x) { return 10L * x; });
+        CHECK(written.data() == dst.data());
+        CHECK(written.size() == 4);
+        CHECK((dst == std::array<long, 6>{10, 20, 30, 40, 0, 0}));
+    }
+
+    // in place
+    {
+        std::array<int, 4> arr{1, 2, 3, 4};
+        gsl::transform(span<const int>(arr), span<int>(arr), [](int x) { return x + 1; });
+        CHECK((arr == std::array<int, 4>{2, 3, 4, 5}));
+    }
+
+    // binary
+    {
+        const std::array<int, 4> a{1, 2, 3, 4};
+        const std::array<int, 5> b{10, 20, 30, 40, 50};
+        std::array<int, 4> out{};
+
+        const auto written = gsl::transform(span<const int>(a), span<const int>(b),
+                                            span<int, 4>(out), [](int x, int y) { return x + y; });
+        CHECK(written.size() == 4);
+        CHECK((out == std::array<int, 4>{11, 22, 33, 44}));
+    }
+}
+
+TEST_CASE("transform_contract_violations")
+{
+    std::array<int, 8> arr{1, 2, 3, 4, 5, 6, 7, 8};
+    const auto identity = [](int x) { return x; };
+    const auto plus = [](int x, int y) { return x + y; };
+
+    const span<int> s(arr);
+
+    // destination too short
+    CHECK_THROWS_AS(gsl::transform(s.first(4), s.subspan(4, 3), identity), fail_fast);
+    CHECK_THROWS_AS(gsl::transform(s.first(2), s.first(1), s.subspan(4, 2), plus), fail_fast);
+    CHECK_THROWS_AS(gsl::transform(s.first(1), s.first(2), s.subspan(4, 0), plus), fail_fast);
+
+    // partially overlapping ranges
+    CHECK_THROWS_AS(gsl::transform(s.first(4), s.subspan(2, 4), identity), fail_fast);
+    CHECK_THROWS_AS(gsl::transform(s.subspan(2, 4), s.first(4), identity), fail_fast);
+    CHECK_THROWS_AS(gsl::transform(s.first(4), s.subspan(4, 4), s.subspan(1, 4), plus),
+                    fail_fast);
+
+    // adjacent ranges are fine
+    gsl::transform(s.first(4), s.subspan(4, 4), identity);
+    CHECK((arr == std::array<int, 8>{1, 2, 3, 4, 1, 2, 3, 4}));
+}
+
+namespace
+{
+std::vector<byte> make_bytes(std::size_t size, unsigned seed)
+{
+    std::vector<byte> v(size);
+    for (std::size_t i = 0; i < size; ++i) v[i] = static_cast<byte>((i * seed + 7) & 0xff);
+    return v;
+}
+} // namespace
+
+TEST_CASE("bitwise_byte_operations")
+{
+    for (const std::size_t size : {0u, 1u, 7u, 8u, 9u, 31u, 64u, 100u})
+    {
+        for (const std::size_t mask_size : {1u, 2u, 3u, 4u, 8u, 13u, 100u, 130u})
+        {
+            const auto data = make_bytes(size, 31);
+            const auto mask = make_bytes(mask_size, 57);
+
+            auto x = data;
+            bitwise_xor(x, mask);
+            auto a = data;
+            bitwise_and(a, mask);
+            auto o = data;
+            bitwise_or(o, mask);
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const auto d = to_integer<unsigned>(data[i]);
+                const auto m = to_integer<unsigned>(mask[i % mask_size]);
+                CHECK(to_integer<unsigned>(x[i]) == (d ^ m));
+                CHECK(to_integer<unsigned>(a[i]) == (d & m));
+                CHECK(to_integer<unsigned>(o[i]) == (d | m));
+            }
+
+            // xor with the same mask restores the data
+            bitwise_xor(x, mask);
+            CHECK(x == data);
+        }
+
+        auto n = make_bytes(size, 13);
+        const auto original = n;
+        bitwise_not(n);
+        for (std::size_t i = 0; i < size; ++i)
+            CHECK(to_integer<unsigned>(n[i]) == (~to_integer<unsigned>(original[i]) & 0xffu));
+    }
+}
+
+TEST_CASE("bitwise_byte_operations_contract_violations")
+{
+    auto buf = make_bytes(16, 3);
+    const span<byte> s(buf);
+
+    // only empty buffers can take an empty mask
+    CHECK_THROWS_AS(bitwise_xor(s, span<const byte>{}), fail_fast);
+    bitwise_xor(s.first(0), span<const byte>{});
+
+    // in place is fine, partial overlap is not
+    bitwise_and(s, s);
+    CHECK(buf == make_bytes(16, 3));
+    CHECK_THROWS_AS(bitwise_or(s.subspan(1), s), fail_fast);
+
+    // a repeated mask must not overlap the destination at all
+    CHECK_THROWS_AS(bitwise_xor(s, s.first(4)), fail_fast);
+    CHECK_THROWS_AS(bitwise_xor(s.first(8), s.subspan(4, 4)), fail_fast);
+    bitwise_xor(s.first(8), s.subspan(8, 4));
+}
+
+TEST_CASE("search")
+{
+    std::vector<byte> haystack = make_bytes(300, 11);
+
+    // every substring is found at its first occurrence
+    for (const std::ptrdiff_t length : {1, 2, 3, 7, 8, 9, 15, 16, 17, 40})
+    {
+        for (const std::ptrdiff_t offset : {0, 1, 5, 64, 130, 300 - 40})
+        {
+            const auto needle = span<const byte>(haystack).subspan(offset, length);
+            const auto expected = std::search(haystack.begin(), haystack.end(), needle.begin(),
+                                              needle.end()) -
+                                  haystack.begin();
+            CHECK(gsl::search(haystack, needle) == expected);
+            CHECK(byte_searcher(needle)(haystack) == expected);
+        }
+    }
+
+    // not found, including matching first and last bytes with a different middle
+    const std::vector<byte> missing{to_byte<7>(), to_byte<0xee>(), to_byte<0xee>(), to_byte<7>()};
+    CHECK(gsl::search(haystack, missing) == 300);
+    std::vector<byte> long_missing = make_bytes(20, 11);
+    long_missing[10] = to_byte<0xee>();
+    CHECK(gsl::search(haystack, long_missing) == 300);
+
+    // empty needle and needle longer than the haystack
+    CHECK(gsl::search(haystack, span<const byte>{}) == 0);
+    CHECK(gsl::search(span<const byte>(haystack).first(3), missing) == 3);
+
+    // a searcher can be reused across buffers
+    const std::vector<byte> magic{to_byte<0x89>(), to_byte<'P'>(), to_byte<'N'>(), to_byte<'G'>()};
+    const byte_searcher png(magic);
+    std::vector<byte> buffer(50, to_byte<'P'>());
+    CHECK(gsl::search(buffer, png) == 50);
+    std::copy(magic.begin(), magic.end(), buffer.begin() + 46);
+    CHECK(gsl::search(buffer, png) == 46);
+    std::copy(magic.begin(), magic.end(), buffer.begin() + 3);
+    CHECK(png(buffer) == 3);
+}
+
+TEST_CASE("constant_time_equal")
+{
+    for (const std::size_t size : {0u, 1u, 7u, 8u, 9u, 32u, 33u, 64u, 4096u})
+    {
+        const auto a = make_bytes(size, 13);
+        CHECK(constant_time_equal(a, a));
+        auto b = a;
+        CHECK(constant_time_equal(a, b));
+
+        // a difference anywhere is seen, including in the tail
+        for (std::size_t i = 0; i < size; i += (size / 5 + 1))
+        {
+            b = a;
+            b[i] ^= to_byte<0x10>();
+            CHECK(!constant_time_equal(a, b));
+        }
+        if (size > 0)
+        {
+            b = a;
+            b[size - 1] ^= to_byte<0x80>();
+            CHECK(!constant_time_equal(a, b));
+        }
+    }
+
+    // different sizes are never equal, even when one is a prefix of the other
+    const auto a = make_bytes(20, 13);
+    CHECK(!constant_time_equal(a, span<const byte>(a).first(19)));
+    CHECK(!constant_time_equal(span<const byte>{}, a));
+}
+
+TEST_CASE("lower_bound")
+{
+    std::vector<std::uint64_t> table;
+    for (std::uint64_t i = 0; i < 300; ++i) table.push_back(i * 3 + (i % 7 == 0 ? 1 : 0));
+    // runs of equal keys
+    table.insert(table.begin() + 100, 20, table[100]);
+
+    for (const std::size_t size : {0u, 1u, 2u, 15u, 16u, 17u, 33u, 100u, 320u})
+    {
+        const auto s = span<const std::uint64_t>(table).first(static_cast<std::ptrdiff_t>(size));
+        for (std::uint64_t key = 0; key < 1000; ++key)
+        {
+            const auto lower = std::lower_bound(table.begin(), table.begin() + s.size(), key) -
+                               table.begin();
+            const auto upper = std::upper_bound(table.begin(), table.begin() + s.size(), key) -
+                               table.begin();
+            CHECK(gsl::lower_bound(s, key) == lower);
+            CHECK(gsl::upper_bound(s, key) == upper);
+            CHECK(gsl::binary_search(s, key) == (lower != upper));
+        }
+    }
+}
+
+TEST_CASE("lower_bound_with_comparator")
+{
+    // sorted in descending order
+    std::vector<int> table(100);
+    for (std::size_t i = 0; i < table.size(); ++i) table[i] = 200 - 2 * static_cast<int>(i);
+    const span<const int> s = table;
+    const auto greater = [](int l, int r) { return l > r; };
+
+    CHECK(gsl::lower_bound(s, 200, greater) == 0);
+    CHECK(gsl::lower_bound(s, 150, greater) == 25);
+    CHECK(gsl::lower_bound(s, 149, greater) == 26);
+    CHECK(gsl::upper_bound(s, 150, greater) == 26);
+    CHECK(gsl::lower_bound(s, 0, greater) == 100);
+    CHECK(gsl::binary_search(s, 150, greater));
+    CHECK(!gsl::binary_search(s, 151, greater));
+
+    // a key of another type than the elements
+    const std::vector<std::string> names{"ada", "bob", "eve", "zed"};
+    CHECK(gsl::lower_bound(span<const std::string>(names), "c") == 2);
+}
+
+TEST_CASE("set_operations")
+{
+    // lists of similar and of very different lengths, with repeated elements
+    const auto make_list = [](std::uint32_t count, std::uint32_t step) {
+        std::vector<std::uint32_t> list;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            list.push_back(i * step);
+            if (i % 5 == 0) list.push_back(i * step);
+        }
+        return list;
+    };
+    const std::vector<std::vector<std::uint32_t>> lists = {
+        {}, make_list(1, 1), make_list(10, 3), make_list(40, 2), make_list(2000, 1)};
+
+    for (const auto& l : lists)
+    {
+        for (const auto& r : lists)
+        {
+            const span<const std::uint32_t> a = l;
+            const span<const std::uint32_t> b = r;
+            std::vector<std::uint32_t> out(l.size() + r.size());
+            std::vector<std::uint32_t> expected;
+
+            std::set_intersection(l.begin(), l.end(), r.begin(), r.end(),
+                                  std::back_inserter(expected));
+            auto n = gsl::set_intersection(a, b, span<std::uint32_t>(out));
+            CHECK(std::vector<std::uint32_t>(out.begin(), out.begin() + n) == expected);
+
+            expected.clear();
+            std::set_union(l.begin(), l.end(), r.begin(), r.end(), std::back_inserter(expected));
+            n = gsl::set_union(a, b, span<std::uint32_t>(out));
+            CHECK(std::vector<std::uint32_t>(out.begin(), out.begin() + n) == expected);
+
+            expected.clear();
+            std::set_difference(l.begin(), l.end(), r.begin(), r.end(),
+                                std::back_inserter(expected));
+            n = gsl::set_difference(a, b, span<std::uint32_t>(out));
+            CHECK(std::vector<std::uint32_t>(out.begin(), out.begin() + n) == expected);
+
+            // in place over the first input
+            std::vector<std::uint32_t> in_place = l;
+            n = gsl::set_difference(span<const std::uint32_t>(in_place), b,
+                                    span<std::uint32_t>(in_place));
+            CHECK(std::vector<std::uint32_t>(in_place.begin(), in_place.begin() + n) ==
+                  expected);
+        }
+    }
+
+    // out may start at a, but must not overlap b
+    std::vector<std::uint32_t> both_lists{1, 2, 2};
+    const span<std::uint32_t> whole = both_lists;
+    CHECK(gsl::set_intersection(span<const std::uint32_t>(whole.first(2)),
+                                span<const std::uint32_t>(whole.last(1)), whole.first(2)) == 1);
+    CHECK(both_lists[0] == 2);
+    both_lists = {1, 2, 2};
+    CHECK_THROWS_AS(gsl::set_intersection(span<const std::uint32_t>(whole.first(2)),
+                                          span<const std::uint32_t>(whole.last(1)),
+                                          whole.last(1)),
+                    fail_fast);
+    CHECK_THROWS_AS(gsl::set_difference(span<const std::uint32_t>(whole.first(1)),
+                                        span<const std::uint32_t>(whole.last(2)), whole.last(2)),
+                    fail_fast);
+    CHECK_THROWS_AS(gsl::set_union(span<const std::uint32_t>(whole.first(1)),
+                                   span<const std::uint32_t>(whole.last(1)), whole),
+                    fail_fast);
+
+    std::uint32_t small[1];
+    const std::vector<std::uint32_t> two{1, 2};
+    const span<const std::uint32_t> both = two;
+    CHECK_THROWS_AS(gsl::set_intersection(both, both, span<std::uint32_t>(small)), fail_fast);
+    CHECK_THROWS_AS(gsl::set_union(both, span<const std::uint32_t>(), span<std::uint32_t>(small)),
+                    fail_fast);
+}
+
+TEST_CASE("set_intersection_of_many")
+{
+    std::vector<std::uint32_t> all(3000);
+    for (std::uint32_t i = 0; i < all.size(); ++i) all[i] = i;
+    std::vector<std::uint32_t> even;
+    for (std::uint32_t i = 0; i < 3000; i += 2) even.push_back(i);
+    const std::vector<std::uint32_t> sparse{6, 7, 12, 18, 20, 2994};
+    std::vector<std::uint32_t> thirds;
+    for (std::uint32_t i = 0; i < 3000; i += 3) thirds.push_back(i);
+
+    const span<const std::uint32_t> lists[] = {all, even, sparse, thirds};
+    std::vector<std::uint32_t> out(sparse.size());
+    const auto n = gsl::set_intersection(span<const span<const std::uint32_t>>(lists),
+                                         span<std::uint32_t>(out));
+    CHECK(std::vector<std::uint32_t>(out.begin(), out.begin() + n) ==
+          std::vector<std::uint32_t>{6, 12, 18, 2994});
+
+    const span<const std::uint32_t> disjoint[] = {even,
+                                                  span<const std::uint32_t>(sparse).subspan(1, 1)};
+    CHECK(gsl::set_intersection(span<const span<const std::uint32_t>>(disjoint),
+                                span<std::uint32_t>(out)) == 0);
+    CHECK(gsl::set_intersection(span<const span<const std::uint32_t>>(),
+                                span<std::uint32_t>(out)) == 0);
+
+    std::vector<std::uint32_t> too_short(2);
+    CHECK_THROWS_AS(gsl::set_intersection(span<const span<const std::uint32_t>>(lists),
+                                          span<std::uint32_t>(too_short)),
+                    fail_fast);
+}
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/aligned_span> // for aligned_span, make_aligned_span
+#include <gsl/span>         // for span
+
+#include <cstddef>     // for ptrdiff_t
+#include <type_traits> // for is_same
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+struct alignas(32) aligned_ints
+{
+    int values[16];
+};
+} // namespace
+
+TEST_CASE("construction")
+{
+    aligned_ints a{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+
+    {
+        const aligned_span<int, dynamic_extent, 32> s(span<int>(a.values));
+        CHECK(s.size() == 16);
+        CHECK(s.size_bytes() == 64);
+        CHECK(s.data() == a.values);
+        CHECK(s[5] == 5);
+        CHECK(!s.empty());
+    }
+
+    {
+        const auto s = make_aligned_span<32>(span<int, 16>(a.values));
+        static_assert(is_same<decltype(s), const aligned_span<int, 16, 32>>::value, "");
+        CHECK(s.as_span().data() == a.values);
+    }
+
+    {
+        const auto s = make_aligned_span<16>(a.values + 4, 8);
+        CHECK(s.size() == 8);
+        CHECK(s[0] == 4);
+        CHECK_THROWS_AS(s[8], fail_fast);
+    }
+
+    {
+        const aligned_span<int, dynamic_extent, 32> s(span<int>{});
+        CHECK(s.empty());
+    }
+
+    // misaligned
+    CHECK_THROWS_AS(make_aligned_span<32>(a.values + 1, 4), fail_fast);
+    CHECK_THROWS_AS(make_aligned_span<32>(a.values + 4, 4), fail_fast);
+}
+
+TEST_CASE("conversions")
+{
+    aligned_ints a{};
+    const auto s = make_aligned_span<32>(span<int, 16>(a.values));
+
+    // weaker alignment, const elements and dynamic extent are fine
+    const aligned_span<const int, dynamic_extent, 16> weaker = s;
+    CHECK(weaker.data() == a.values);
+
+    const span<int> plain = s;
+    CHECK(plain.size() == 16);
+
+    // to exactly span_type, through span's container constructor alone
+    auto m = make_aligned_span<32>(span<int, 16>(a.values));
+    const span<int, 16> exact = m;
+    CHECK(exact.data() == a.values);
+    const span<int, 16> back = s.as_span();
+    CHECK(back.data() == a.values);
+
+    static_assert(!is_convertible<aligned_span<int, 16, 16>, aligned_span<int, 16, 32>>::value,
+                  "stronger alignment must be checked");
+}
+
+TEST_CASE("subviews")
+{
+    aligned_ints a{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    const auto s = make_aligned_span<32>(span<int>(a.values));
+
+    {
+        const auto f = s.first<4>();
+        static_assert(is_same<decltype(f), const aligned_span<int, 4, 32>>::value, "");
+        CHECK(f.size() == 4);
+        CHECK(f.data() == a.values);
+    }
+
+    {
+        const auto f = s.first(3);
+        CHECK(f.size() == 3);
+        CHECK_THROWS_AS(s.first(17), fail_fast);
+    }
+
+    {
+        const auto sub = s.subspan<8, 4>();
+        static_assert(is_same<decltype(sub), const aligned_span<int, 4, 32>>::value, "");
+        CHECK(sub[0] == 8);
+    }
+
+    {
+        const auto fixed = make_aligned_span<32>(span<int, 16>(a.values));
+        const auto sub = fixed.subspan<8>();
+        static_assert(is_same<decltype(sub), const aligned_span<int, 8, 32>>::value, "");
+        CHECK(sub[7] == 15);
+    }
+
+    {
+        const auto sub = s.subspan(8);
+        CHECK(sub.size() == 8);
+        CHECK(sub[0] == 8);
+
+        CHECK(s.subspan(16).empty());
+        CHECK_THROWS_AS(s.subspan(4), fail_fast);
+        CHECK_THROWS_AS(s.subspan(8, 9), fail_fast);
+    }
+}
+
+TEST_CASE("iteration")
+{
+    aligned_ints a{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    const auto s = make_aligned_span<32>(span<int>(a.values));
+
+    int sum = 0;
+    for (const int x : s) sum += x;
+    CHECK(sum == 120);
+
+    CHECK(s.cend() - s.cbegin() == 16);
+}
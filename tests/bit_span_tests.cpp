@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/bit_span> // for bit_span, cbit_span, rank_index, bitwise_and...
+#include <gsl/gsl_byte> // for byte, to_byte
+#include <gsl/span>     // for span
+
+#include <cstddef> // for ptrdiff_t
+#include <vector>  // for vector
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+// reference bit i of the byte array, independent of bit_span
+bool bit_of(const byte* bytes, std::ptrdiff_t i)
+{
+    return ((to_integer<unsigned>(bytes[i / 8]) >> (i % 8)) & 1u) != 0;
+}
+} // namespace
+
+TEST_CASE("construction")
+{
+    byte bytes[4] = {};
+
+    const bit_span all(bytes);
+    CHECK(all.size() == 32);
+    CHECK(all.bytes().size() == 4);
+
+    const bit_span part(bytes, 27);
+    CHECK(part.size() == 27);
+    CHECK_THROWS_AS(bit_span(bytes, 33), fail_fast);
+    CHECK_THROWS_AS(bit_span(bytes, -1), fail_fast);
+
+    const cbit_span c = part;
+    CHECK(c.size() == 27);
+
+    const bit_span empty;
+    CHECK(empty.empty());
+    CHECK(empty.count() == 0);
+    CHECK(empty.find_first_set() == 0);
+}
+
+TEST_CASE("element_access")
+{
+    byte bytes[2] = {};
+    const bit_span s(bytes, 12);
+
+    s[0] = true;
+    s.set(9);
+    s[3] = s[0];
+    CHECK(to_integer<int>(bytes[0]) == 0x09);
+    CHECK(to_integer<int>(bytes[1]) == 0x02);
+
+    CHECK(s[0]);
+    CHECK(!s[1]);
+    CHECK(s.test(9));
+
+    s.reset(0);
+    s.flip(1);
+    s[2].flip();
+    CHECK(to_integer<int>(bytes[0]) == 0x0e);
+
+    CHECK_THROWS_AS(s[12], fail_fast);
+    CHECK_THROWS_AS(s.set(12), fail_fast);
+    CHECK_THROWS_AS(s.test(-1), fail_fast);
+
+    const cbit_span c = s;
+    const bool bit = c[9];
+    CHECK(bit);
+}
+
+TEST_CASE("count_and_rank")
+{
+    std::vector<byte> bytes(37);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<byte>((i * 37 + 11) & 0xff);
+
+    for (const std::ptrdiff_t size : {0, 1, 7, 8, 9, 63, 64, 65, 200, 290, 296})
+    {
+        const cbit_span s(bytes, size);
+        std::ptrdiff_t expected = 0;
+        for (std::ptrdiff_t i = 0; i < size; ++i)
+        {
+            CHECK(s.rank(i) == expected);
+            if (bit_of(bytes.data(), i)) ++expected;
+        }
+        CHECK(s.rank(size) == expected);
+        CHECK(s.count() == expected);
+        CHECK_THROWS_AS(s.rank(size + 1), fail_fast);
+    }
+}
+
+TEST_CASE("select_and_find")
+{
+    std::vector<byte> bytes(40);
+    const bit_span s(bytes, 317);
+
+    const std::ptrdiff_t positions[] = {3, 64, 65, 130, 255, 316};
+    for (const auto p : positions) s.set(p);
+
+    // bits past the end of the span are not seen
+    bytes[39] |= to_byte<0xe0>();
+
+    CHECK(s.count() == 6);
+    for (std::ptrdiff_t n = 0; n < 6; ++n) CHECK(s.select(n) == positions[n]);
+    CHECK(s.select(6) == s.size());
+    CHECK_THROWS_AS(s.select(-1), fail_fast);
+
+    CHECK(s.find_first_set() == 3);
+    CHECK(s.find_first_set(4) == 64);
+    CHECK(s.find_first_set(66) == 130);
+    CHECK(s.find_first_set(131) == 255);
+    CHECK(s.find_first_set(316) == 316);
+    CHECK(s.find_first_set(317) == 317);
+    CHECK_THROWS_AS(s.find_first_set(318), fail_fast);
+
+    std::vector<std::ptrdiff_t> visited;
+    s.for_each_set([&](std::ptrdiff_t i) { visited.push_back(i); });
+    CHECK(visited == std::vector<std::ptrdiff_t>(std::begin(positions), std::end(positions)));
+}
+
+TEST_CASE("rank_index")
+{
+    std::vector<byte> bytes(300);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<byte>((i * 37 + 11) & (i % 97 < 60 ? 0xff : 0x00));
+
+    for (const std::ptrdiff_t size : {0, 1, 511, 512, 513, 1024, 1500, 2400})
+    {
+        const cbit_span s(bytes, size);
+        const rank_index index(s);
+        CHECK(index.size() == size);
+        CHECK(index.count() == s.count());
+        for (std::ptrdiff_t i = 0; i <= size; ++i) CHECK(index.rank(i) == s.rank(i));
+        for (std::ptrdiff_t n = 0; n <= s.count(); ++n) CHECK(index.select(n) == s.select(n));
+        CHECK_THROWS_AS(index.rank(size + 1), fail_fast);
+        CHECK_THROWS_AS(index.select(-1), fail_fast);
+    }
+
+    const rank_index empty;
+    CHECK(empty.count() == 0);
+    CHECK(empty.select(0) == 0);
+}
+
+TEST_CASE("bitwise_operations")
+{
+    std::vector<byte> a(20), b(20);
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<byte>((i * 29 + 3) & 0xff);
+        b[i] = static_cast<byte>((i * 71 + 5) & 0xff);
+    }
+
+    const auto check = [&](void (*op)(bit_span, cbit_span), unsigned (*expected)(unsigned, unsigned)) {
+        std::vector<byte> dest = a;
+        op(bit_span(dest, 157), cbit_span(b, 157));
+        for (std::ptrdiff_t i = 0; i < 160; ++i)
+        {
+            const unsigned l = bit_of(a.data(), i) ? 1 : 0;
+            const unsigned r = bit_of(b.data(), i) ? 1 : 0;
+            // bits past the end are left alone
+            const unsigned want = i < 157 ? (expected(l, r) & 1u) : l;
+            CHECK(bit_of(dest.data(), i) == (want != 0));
+        }
+    };
+
+    check(bitwise_and, [](unsigned l, unsigned r) { return l & r; });
+    check(bitwise_or, [](unsigned l, unsigned r) { return l | r; });
+    check(bitwise_xor, [](unsigned l, unsigned r) { return l ^ r; });
+    check(bitwise_andnot, [](unsigned l, unsigned r) { return l & ~r; });
+
+    // in place
+    std::vector<byte> dest = a;
+    bitwise_xor(bit_span(dest), cbit_span(dest));
+    CHECK(cbit_span(dest).count() == 0);
+
+    CHECK_THROWS_AS(bitwise_or(bit_span(a, 10), cbit_span(b, 11)), fail_fast);
+    CHECK_THROWS_AS(bitwise_or(bit_span(a), cbit_span(span<byte>(a).subspan(1))), fail_fast);
+}
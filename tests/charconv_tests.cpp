@@ -0,0 +1,364 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/gsl_charconv> // for parse, parse_result
+#include <gsl/string_span>  // for cstring_span
+
+#include <cmath>        // for isinf, isnan, signbit
+#include <cstdint>      // for int8_t, uint8_t, int64_t, uint64_t
+#include <cstdio>       // for snprintf
+#include <cstdlib>      // for strtod
+#include <cstring>      // for memcpy, strlen
+#include <limits>       // for numeric_limits
+#include <random>       // for mt19937_64
+#include <string>       // for string
+#include <system_error> // for errc
+
+using namespace std;
+using namespace gsl;
+
+TEST_CASE("parse_integers")
+{
+    {
+        const auto r = parse<int>("12345,rest");
+        CHECK(r);
+        CHECK(r.value == 12345);
+        CHECK(r.length == 5);
+    }
+    {
+        const auto r = parse<int>("-2147483648");
+        CHECK(r);
+        CHECK(r.value == (numeric_limits<int>::min)());
+        CHECK(r.length == 11);
+    }
+
+    CHECK(parse<int>("2147483647").value == 2147483647);
+    CHECK(parse<int>("-0").value == 0);
+    CHECK(parse<int>("0000000000000000000042").value == 42);
+    CHECK(parse<std::uint64_t>("18446744073709551615").value ==
+          (numeric_limits<std::uint64_t>::max)());
+    CHECK(parse<std::int64_t>("-9223372036854775808").value ==
+          (numeric_limits<std::int64_t>::min)());
+    CHECK(parse<std::int64_t>("123456789012345678").value == 123456789012345678);
+    CHECK(parse<std::int8_t>("-128").value == -128);
+    CHECK(parse<std::uint8_t>("255").value == 255);
+
+    // out of range numbers are consumed whole
+    {
+        const auto r = parse<int>("2147483648 ");
+        CHECK(!r);
+        CHECK(r.ec == errc::result_out_of_range);
+        CHECK(r.length == 10);
+    }
+    CHECK(parse<std::uint8_t>("256").ec == errc::result_out_of_range);
+    CHECK(parse<std::int8_t>("-129").ec == errc::result_out_of_range);
+    CHECK(parse<std::int8_t>("12345678").ec == errc::result_out_of_range);
+    CHECK(parse<std::uint64_t>("18446744073709551616").ec == errc::result_out_of_range);
+
+    // not a number
+    for (const char* s : {"", "-", "+1", " 1", "x1", "-x"})
+    {
+        const auto r = parse<int>(cstring_span<>(s, static_cast<std::ptrdiff_t>(strlen(s))));
+        CHECK(r.ec == errc::invalid_argument);
+        CHECK(r.length == 0);
+    }
+    CHECK(parse<unsigned>("-1").ec == errc::invalid_argument);
+
+    // does not read past the end of the span
+    const char digits[] = "1234567890123";
+    CHECK(parse<long long>(cstring_span<>(digits, 9)).value == 123456789);
+}
+
+TEST_CASE("parse_floating_point")
+{
+    const auto check_double = [](const char* s, std::ptrdiff_t length) {
+        const auto r = parse<double>(cstring_span<>(s, static_cast<std::ptrdiff_t>(strlen(s))));
+        CHECK(r);
+        CHECK(r.length == length);
+        char* end = nullptr;
+        CHECK(r.value == strtod(s, &end));
+        CHECK(end - s == length);
+    };
+
+    check_double("0", 1);
+    check_double("-0.0", 4);
+    check_double("1.5", 3);
+    check_double("3.14159265358979323846264338327950288", 37);
+    check_double(".5x", 2);
+    check_double("7.", 2);
+    check_double("1e10", 4);
+    check_double("1E-5", 4);
+    check_double("2e", 1);
+    check_double("2e+", 1);
+    check_double("-12.375e+2,", 10);
+    check_double("123456789012345678901234567890", 30);
+    check_double("0.000000000000000000000000000123", 32);
+    check_double("9007199254740993", 16);
+    check_double("1.7976931348623157e308", 22);
+    check_double("4.9406564584124654e-324", 23);
+    check_double("2.2250738585072011e-308", 23);
+    check_double("12345678.87654321", 17);
+
+    CHECK(std::signbit(parse<double>("-0").value));
+    CHECK(std::isinf(parse<double>("inf").value));
+    CHECK(parse<double>("-Infinity").value == -numeric_limits<double>::infinity());
+    CHECK(parse<double>("-Infinity").length == 9);
+    CHECK(std::isnan(parse<double>("NaN").value));
+
+    CHECK(parse<float>("0.1").value == 0.1f);
+    CHECK(parse<float>("16777217").value == 16777216.0f);
+    CHECK(parse<float>("3.4028235e38").value == numeric_limits<float>::max());
+    CHECK(parse<float>("1e39").ec == errc::result_out_of_range);
+
+    CHECK(parse<double>("1e400").ec == errc::result_out_of_range);
+    CHECK(parse<double>("1e-400").ec == errc::result_out_of_range);
+    CHECK(parse<double>(".").ec == errc::invalid_argument);
+    CHECK(parse<double>("-.e1").ec == errc::invalid_argument);
+    CHECK(parse<double>("e1").ec == errc::invalid_argument);
+
+    // more digits than the slow path keeps: 1 + 2^-53 + a tiny bit rounds up
+    std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+    CHECK(parse<double>(halfway).value == 1.0);
+    halfway += std::string(1000, '0') + "1";
+    CHECK(parse<double>(halfway).value == 1.0000000000000002);
+}
+
+TEST_CASE("parse_floating_point_round_trip")
+{
+    std::mt19937_64 rng(42);
+    char buf[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (std::isnan(d) || std::isinf(d)) continue;
+        for (const char* format : {"%.17g", "%.6g", "%.15e"})
+        {
+            const int n = std::snprintf(buf, sizeof(buf), format, d);
+            const auto r = parse<double>(cstring_span<>(buf, n));
+            CHECK(r.length == n);
+            CHECK(r.value == strtod(buf, nullptr));
+        }
+    }
+}
+
+TEST_CASE("to_chars_integers")
+{
+    char buf[32];
+
+    CHECK(to_chars(buf, 0) == "0");
+    CHECK(to_chars(buf, 7) == "7");
+    CHECK(to_chars(buf, 42) == "42");
+    CHECK(to_chars(buf, 100) == "100");
+    CHECK(to_chars(buf, -12345) == "-12345");
+    CHECK(to_chars(buf, (numeric_limits<int>::min)()) == "-2147483648");
+    CHECK(to_chars(buf, (numeric_limits<std::int64_t>::min)()) == "-9223372036854775808");
+    CHECK(to_chars(buf, (numeric_limits<std::uint64_t>::max)()) == "18446744073709551615");
+    CHECK(to_chars(buf, static_cast<std::int8_t>(-128)) == "-128");
+
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto value = static_cast<long long>(rng() >> (rng() % 64));
+        CHECK(to_chars(buf, value) == std::to_string(value));
+        CHECK(to_chars(buf, -value) == std::to_string(-value));
+    }
+
+    // the result is a prefix of the destination, which must be large enough
+    const auto written = to_chars(buf, 123);
+    CHECK(written.data() == buf);
+    CHECK(written.size() == 3);
+    CHECK(to_chars(span<char>(buf, 3), 999) == "999");
+    CHECK_THROWS_AS(to_chars(span<char>(buf, 3), 1000), fail_fast);
+    CHECK_THROWS_AS(to_chars(span<char>(buf, 2), -10), fail_fast);
+}
+
+TEST_CASE("to_chars_floating_point")
+{
+    char buf[32];
+
+    CHECK(to_chars(buf, 0.0) == "0");
+    CHECK(to_chars(buf, -0.0) == "-0");
+    CHECK(to_chars(buf, 0.1) == "0.1");
+    CHECK(to_chars(buf, 1.5) == "1.5");
+    CHECK(to_chars(buf, -2.0) == "-2");
+    CHECK(to_chars(buf, 0.3f) == "0.3");
+    CHECK(to_chars(buf, 1e300) == "1e+300");
+    CHECK(to_chars(buf, numeric_limits<double>::infinity()) == "inf");
+    CHECK(to_chars(buf, -numeric_limits<double>::infinity()) == "-inf");
+    CHECK(to_chars(buf, numeric_limits<double>::quiet_NaN()) == "nan");
+
+    // the output is short and reads back as the same value
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        if (std::isnan(d)) continue;
+        const auto s = to_chars(buf, d);
+        CHECK(s.size() <= 24);
+        CHECK(parse<double>(s).value == d);
+        CHECK(parse<double>(s).length == s.size());
+
+        std::uint32_t fbits = static_cast<std::uint32_t>(bits);
+        float f;
+        std::memcpy(&f, &fbits, sizeof(f));
+        if (std::isnan(f)) continue;
+        const auto fs = to_chars(buf, f);
+        CHECK(fs.size() <= 16);
+        CHECK(parse<float>(fs).value == f);
+    }
+
+    CHECK_THROWS_AS(to_chars(span<char>(buf, 3), 0.125), fail_fast);
+}
+
+TEST_CASE("format_to")
+{
+    char buf[64];
+
+    const std::string unit = "ms";
+    const auto s = format_to(buf, "latency=", 12.5, unit, ' ', "count=", 3u, " ok=", true);
+    CHECK(s == "latency=12.5ms count=3 ok=true");
+    CHECK(s.data() == buf);
+
+    CHECK(format_to(buf).empty());
+    CHECK(format_to(buf, cstring_span<>("abc")) == "abc");
+    CHECK(format_to(buf, -1, ',', -0.5) == "-1,-0.5");
+
+    CHECK(format_to(span<char>(buf, 10), "0123456789") == "0123456789");
+    CHECK_THROWS_AS(format_to(span<char>(buf, 10), "01234", 567890), fail_fast);
+}
+
+TEST_CASE("json_escape")
+{
+    char buf[128];
+
+    const cstring_span<> plain = "nothing to escape in this long enough string";
+    CHECK(json_escaped_size(plain) == plain.size());
+    CHECK(json_escape(plain, buf) == plain);
+
+    const std::string special = std::string("say \"hi\"\\\n\t\b\f\r") + '\0' + "\x1f\xc3\xa9";
+    const cstring_span<> expected = "say \\\"hi\\\"\\\\\\n\\t\\b\\f\\r\\u0000\\u001f\xc3\xa9";
+    CHECK(json_escaped_size(special) == expected.size());
+    CHECK(json_escape(special, buf) == expected);
+
+    // a special character at every position of a word
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        std::string s(20, 'x');
+        s[i] = '"';
+        std::string want = s.substr(0, i) + "\\\"" + s.substr(i + 1);
+        CHECK(json_escape(s, buf) == want);
+    }
+
+    CHECK(json_escape(cstring_span<>{}, buf).empty());
+    CHECK_THROWS_AS(json_escape("a\"b", span<char>(buf, 3)), fail_fast);
+}
+
+TEST_CASE("json_unescape")
+{
+    char buf[128];
+
+    const auto r = json_unescape("say \\\"hi\\\"\\\\\\/\\n\\t\\b\\f\\r\\u0000\\u001F", buf);
+    REQUIRE(r);
+    CHECK(r.value == std::string("say \"hi\"\\/\n\t\b\f\r") + '\0' + "\x1f");
+    CHECK(r.length == 36);
+
+    // UTF-8 for every length, and a surrogate pair
+    const auto u = json_unescape("\\u0041\\u00e9\\u20AC\\ud83d\\ude00 plain", buf);
+    REQUIRE(u);
+    CHECK(u.value == "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80 plain");
+
+    // round trip
+    const std::string text = "a \"quoted\"\tline\nwith \\ and \x01";
+    char escaped[128];
+    const auto e = json_escape(text, escaped);
+    CHECK(json_unescape(e, buf).value == text);
+
+    const cstring_span<> invalid[] = {"\\",        "ab\\x",         "\\u12",     "\\u12g4",
+                                      "\\udc00",   "\\ud83d",       "\\ud83dx",  "\\ud83d\\u0041",
+                                      "ok\\ud83d\\"};
+    for (const auto& s : invalid)
+    {
+        const auto bad = json_unescape(s, buf);
+        CHECK(!bad);
+        CHECK(bad.ec == std::errc::invalid_argument);
+    }
+    const auto bad = json_unescape("abc\\qdef", buf);
+    CHECK(bad.length == 3);
+    CHECK(bad.value == "abc");
+}
+
+TEST_CASE("csv_escape")
+{
+    char buf[64];
+
+    CHECK(csv_escaped_size("plain field") == 11);
+    CHECK(csv_escape("plain field", buf) == "plain field");
+    CHECK(csv_escape("a,b", buf) == "\"a,b\"");
+    CHECK(csv_escape("say \"hi\"", buf) == "\"say \"\"hi\"\"\"");
+    CHECK(csv_escaped_size("say \"hi\"") == 12);
+    CHECK(csv_escape("two\nlines", buf) == "\"two\nlines\"");
+    CHECK(csv_escape("a;b,c", buf, ';') == "\"a;b,c\"");
+    CHECK(csv_escape("a,b", buf, ';') == "a,b");
+    CHECK(csv_escape("\"", buf) == "\"\"\"\"");
+    CHECK(csv_escape(cstring_span<>{}, buf).empty());
+    CHECK_THROWS_AS(csv_escape("a,b", span<char>(buf, 4)), fail_fast);
+
+    // a special character late in a long field
+    std::string field(40, 'x');
+    field[37] = '\r';
+    CHECK(csv_escaped_size(field) == 42);
+}
+
+TEST_CASE("csv_unescape")
+{
+    char buf[64];
+
+    const auto plain = csv_unescape("plain", buf);
+    REQUIRE(plain);
+    CHECK(plain.value == "plain");
+
+    const auto quoted = csv_unescape("\"say \"\"hi\"\", ok\"", buf);
+    REQUIRE(quoted);
+    CHECK(quoted.value == "say \"hi\", ok");
+    CHECK(quoted.length == 16);
+
+    CHECK(csv_unescape("\"\"", buf).value.empty());
+    CHECK(csv_unescape("\"\"\"\"", buf).value == "\"");
+
+    const auto unclosed = csv_unescape("\"abc", buf);
+    CHECK(!unclosed);
+    CHECK(unclosed.length == 4);
+    const auto lone = csv_unescape("\"ab\"c\"", buf);
+    CHECK(!lone);
+    CHECK(lone.length == 3);
+    CHECK(!csv_unescape("\"", buf));
+
+    const std::string text = "x,\"y\"\nz";
+    char escaped[64];
+    CHECK(csv_unescape(csv_escape(text, escaped), buf).value == text);
+}
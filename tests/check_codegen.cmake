@@ -0,0 +1,118 @@
+# Checks the assembly generated for codegen_probes.cpp against the
+# CHECK directives found in the probe source.
+#
+# usage: cmake -DSOURCE=<probes.cpp> -DASSEMBLY=<probes.s>
+#              [-DCOMPILER_ID=<id> -DCOMPILER_VERSION=<version>] -P check_codegen.cmake
+#
+# Only ELF x86-64 assembly (as emitted by GCC and Clang) is understood.
+
+if(NOT SOURCE OR NOT ASSEMBLY)
+    message(FATAL_ERROR "usage: cmake -DSOURCE=<file> -DASSEMBLY=<file> -P check_codegen.cmake")
+endif()
+
+file(READ ${ASSEMBLY} asm)
+file(STRINGS ${SOURCE} directives REGEX "^// CHECK")
+
+set(failures 0)
+set(label "")
+set(body "")
+set(skipping FALSE)
+
+function(report_failure message)
+    message(SEND_ERROR "${label}: ${message}")
+    math(EXPR count "${failures} + 1")
+    set(failures ${count} PARENT_SCOPE)
+endfunction()
+
+# turns \n and \t in the regex ${var} into a newline and a tab, which CMake's regular
+# expressions do not understand, so patterns can span consecutive instructions
+macro(expand_escapes var)
+    string(REPLACE "\\n" "\n" ${var} "${${var}}")
+    string(REPLACE "\\t" "\t" ${var} "${${var}}")
+endmacro()
+
+# extracts the instructions of the function ${name} into ${out}
+function(extract_function name out)
+    string(FIND "${asm}" "\n${name}:\n" begin)
+    if(begin EQUAL -1)
+        set(${out} "" PARENT_SCOPE)
+        return()
+    endif()
+    string(SUBSTRING "${asm}" ${begin} -1 rest)
+    string(FIND "${rest}" "\t.size\t${name}," end)
+    if(NOT end EQUAL -1)
+        string(SUBSTRING "${rest}" 0 ${end} rest)
+    endif()
+    set(${out} "${rest}" PARENT_SCOPE)
+endfunction()
+
+foreach(directive ${directives})
+    if(directive MATCHES "^// CHECK-LABEL: *([A-Za-z_0-9]+)")
+        set(label ${CMAKE_MATCH_1})
+        extract_function(${label} body)
+        set(skipping FALSE)
+        if(body STREQUAL "")
+            report_failure("function not found in ${ASSEMBLY}")
+        endif()
+
+    elseif(label STREQUAL "" OR body STREQUAL "" OR skipping)
+        # no function to check against, already reported above, or the
+        # remaining directives do not apply to this compiler
+
+    elseif(directive MATCHES "^// CHECK-REQUIRES: *([A-Za-z]+) +([0-9.]+)")
+        if(NOT COMPILER_ID STREQUAL CMAKE_MATCH_1 OR
+           COMPILER_VERSION VERSION_LESS CMAKE_MATCH_2)
+            message(STATUS "${label}: skipping checks for ${CMAKE_MATCH_1} ${CMAKE_MATCH_2}")
+            set(skipping TRUE)
+        endif()
+
+    elseif(directive MATCHES "^// CHECK-NO-CALLS")
+        # calls and tail calls; the contract failure path is allowed
+        string(REGEX MATCHALL "\n[ \t]+(call[a-z]*|jmp)[ \t]+[A-Za-z_*][^\n]*" calls "${body}")
+        foreach(call ${calls})
+            if(NOT call MATCHES "terminate")
+                string(STRIP "${call}" call)
+                report_failure("unexpected call '${call}'")
+            endif()
+        endforeach()
+
+    elseif(directive MATCHES "^// CHECK-MAX-BRANCHES: *([0-9]+)")
+        set(limit ${CMAKE_MATCH_1})
+        string(REGEX MATCHALL "\n[ \t]+j[a-z]+[ \t]" jumps "${body}")
+        set(branches 0)
+        foreach(jump ${jumps})
+            if(NOT jump MATCHES "jmp")
+                math(EXPR branches "${branches} + 1")
+            endif()
+        endforeach()
+        if(branches GREATER limit)
+            report_failure("${branches} conditional branches, expected at most ${limit}")
+        endif()
+
+    elseif(directive MATCHES "^// CHECK-VECTORIZED")
+        if(NOT body MATCHES "\n[ \t]+v?(padd|psub|pmul|pand|por|pxor|pcmp|movdq|movup|movap|addp|mulp)")
+            report_failure("no packed SIMD instructions found")
+        endif()
+
+    elseif(directive MATCHES "^// CHECK-NOT: *(.+)$")
+        set(pattern "${CMAKE_MATCH_1}")
+        set(regex "${pattern}")
+        expand_escapes(regex)
+        if(body MATCHES "${regex}")
+            report_failure("unexpected match for '${pattern}'")
+        endif()
+
+    elseif(directive MATCHES "^// CHECK: *(.+)$")
+        set(pattern "${CMAKE_MATCH_1}")
+        set(regex "${pattern}")
+        expand_escapes(regex)
+        if(NOT body MATCHES "${regex}")
+            report_failure("no match for '${pattern}'")
+        endif()
+
+    endif()
+endforeach()
+
+if(failures GREATER 0)
+    message(FATAL_ERROR "${failures} codegen check(s) failed")
+endif()
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Probe functions for the codegen test.
+//
+// This file is never linked: it is compiled with -O2 to assembly and the
+// output is checked by check_codegen.cmake against the directives below.
+// Each probe is extern "C" so its label can be found in the assembly.
+//
+// Supported directives (apply to the most recent CHECK-LABEL):
+//
+//   CHECK-LABEL: <function>    start checking <function>
+//   CHECK-NO-CALLS             no calls other than to std::terminate
+//   CHECK-MAX-BRANCHES: <n>    at most <n> conditional branches
+//   CHECK-VECTORIZED           at least one packed SIMD instruction
+//   CHECK: <regex>             the function body matches <regex>
+//   CHECK-NOT: <regex>         the function body does not match <regex>
+//                              (\n and \t in <regex> match a newline and a tab,
+//                              each instruction is on a line of its own after a tab)
+//   CHECK-REQUIRES: <id> <ver> the directives that follow only apply to the
+//                              compiler <id> (GNU, Clang) from version <ver>
+//
+
+#include <gsl/aligned_span>  // for aligned_span
+#include <gsl/gsl_algorithm> // for for_each, transform, lower_bound, set_union...
+#include <gsl/pointers>      // for not_null
+#include <gsl/span>          // for span, as_bytes
+
+#include <cstddef> // for ptrdiff_t
+#include <cstdint> // for uint32_t, uint64_t
+
+// GCC only runs the vectorizer at -O2 from version 12 on; the probes that check
+// for vectorized loops turn it on themselves
+#if defined(__GNUC__) && !defined(__clang__)
+#define PROBE_VECTORIZE __attribute__((optimize("tree-vectorize")))
+#else
+#define PROBE_VECTORIZE
+#endif
+
+struct probe_record
+{
+    int value;
+};
+
+extern "C" {
+
+// CHECK-LABEL: probe_span_index
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 1
+int probe_span_index(gsl::span<const int> s, std::ptrdiff_t i) { return s[i]; }
+
+// CHECK-LABEL: probe_span_range_for
+// CHECK-NO-CALLS
+// CHECK-NOT: terminate
+// CHECK-MAX-BRANCHES: 2
+int probe_span_range_for(gsl::span<const int> s)
+{
+    int sum = 0;
+    for (const int x : s) sum += x;
+    return sum;
+}
+
+// CHECK-LABEL: probe_span_range_for_fixed
+// CHECK-NO-CALLS
+// CHECK-NOT: terminate
+// CHECK-VECTORIZED
+PROBE_VECTORIZE void probe_span_range_for_fixed(gsl::span<int, 64> s)
+{
+    for (int& x : s) x += 1;
+}
+
+// CHECK-LABEL: probe_span_subspan
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 5
+std::ptrdiff_t probe_span_subspan(gsl::span<const int> s, std::ptrdiff_t offset,
+                                  std::ptrdiff_t count)
+{
+    return s.subspan(offset, count).size();
+}
+
+// CHECK-LABEL: probe_span_first_n
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 2
+const int* probe_span_first_n(gsl::span<const int> s) { return s.first<4>().data(); }
+
+// CHECK-LABEL: probe_span_as_bytes
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 3
+std::ptrdiff_t probe_span_as_bytes(gsl::span<const int> s) { return gsl::as_bytes(s).size(); }
+
+// CHECK-LABEL: probe_not_null_arrow
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 1
+int probe_not_null_arrow(gsl::not_null<probe_record*> p) { return p->value; }
+
+// CHECK-LABEL: probe_for_each_fixed
+// CHECK-NO-CALLS
+// CHECK-NOT: terminate
+// CHECK-VECTORIZED
+PROBE_VECTORIZE void probe_for_each_fixed(gsl::span<int, 64> s)
+{
+    gsl::for_each(s, [](int& x) { x += 1; });
+}
+
+// CHECK-LABEL: probe_transform_fixed
+// CHECK-NO-CALLS
+// CHECK-VECTORIZED
+PROBE_VECTORIZE void probe_transform_fixed(gsl::span<const int, 64> a,
+                                           gsl::span<const int, 64> b, gsl::span<int, 64> out)
+{
+    gsl::transform(a, b, out, [](int x, int y) { return x + y; });
+}
+
+// CHECK-LABEL: probe_aligned_span_data_loop
+// CHECK-NO-CALLS
+// CHECK-VECTORIZED
+// CHECK-NOT: movdqu|movups
+PROBE_VECTORIZE void probe_aligned_span_data_loop(gsl::aligned_span<int, 64, 16> s)
+{
+    int* const p = s.data();
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) p[i] += 1;
+}
+
+// CHECK-LABEL: probe_bitwise_xor_mask
+// CHECK-NO-CALLS
+void probe_bitwise_xor_mask(gsl::span<gsl::byte> payload, gsl::span<const gsl::byte, 4> key)
+{
+    gsl::bitwise_xor(payload, key);
+}
+
+// the only branches are on the sizes: the size check, and entering and repeating the word
+// and the byte loops; none exits the loops early on a mismatch, so nothing branches on a
+// test of the accumulated difference or on a compare against the buffers
+// CHECK-LABEL: probe_constant_time_equal
+// CHECK-NO-CALLS
+// CHECK-MAX-BRANCHES: 5
+// CHECK-NOT: \n\t[a-z]*test[a-z]*\t[^\n]*\n\tj[a-z]+\t
+// CHECK-NOT: \n\t[a-z]*cmp[a-z]*\t[^\n]*\([^\n]*\n\tj[a-z]+\t
+bool probe_constant_time_equal(gsl::span<const gsl::byte> l, gsl::span<const gsl::byte> r)
+{
+    return gsl::constant_time_equal(l, r);
+}
+
+// the halving steps use a conditional move, not a branch on the comparison
+// CHECK-LABEL: probe_lower_bound
+// CHECK-NO-CALLS
+// CHECK-REQUIRES: GNU 12
+// CHECK: cmov
+// CHECK-MAX-BRANCHES: 4
+std::ptrdiff_t probe_lower_bound(gsl::span<const std::uint64_t> s, std::uint64_t key)
+{
+    return gsl::lower_bound(s, key);
+}
+
+// the merge picks the element with a conditional move and advances by adding the
+// comparisons; the branches are the size check, two for each of the two overlap checks,
+// entering and repeating the merge loop on both bounds (four), and entering and repeating
+// the copy of the rest of each input (four)
+// CHECK-LABEL: probe_set_union
+// CHECK-NO-CALLS
+// CHECK-REQUIRES: GNU 12
+// CHECK: cmov
+// CHECK-MAX-BRANCHES: 13
+std::ptrdiff_t probe_set_union(gsl::span<const std::uint32_t> a,
+                               gsl::span<const std::uint32_t> b, gsl::span<std::uint32_t> out)
+{
+    return gsl::set_union(a, b, out);
+}
+
+} // extern "C"
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/gsl_assert> // for Ensures, Expects, contract_profile_snapshot
+#include <gsl/span>       // for span
+
+#include <cstring> // for strcmp, strstr
+
+using namespace gsl;
+
+namespace
+{
+int expects_site = 0;
+int ensures_site = 0;
+
+int checked(int i)
+{
+    expects_site = __LINE__ + 1;
+    Expects(i > 0 && i < 10);
+    i++;
+    ensures_site = __LINE__ + 1;
+    Ensures(i > 0 && i < 10);
+    return i;
+}
+
+const contract_site_stats* find_site(const std::vector<contract_site_stats>& stats, int line)
+{
+    for (const auto& s : stats)
+        if (s.line == line && std::strstr(s.file.c_str(), "contract_profile_tests") != nullptr)
+            return &s;
+    return nullptr;
+}
+} // namespace
+
+TEST_CASE("counts_hits_per_site")
+{
+    contract_profile_reset();
+
+    for (int i = 0; i < 5; ++i) checked(1);
+    CHECK_THROWS_AS(checked(9), fail_fast);
+
+    const auto stats = contract_profile_snapshot();
+
+    const auto expects = find_site(stats, expects_site);
+    REQUIRE(expects != nullptr);
+    CHECK(expects->hits == 6);
+    CHECK(std::strcmp(expects->type, "Precondition") == 0);
+
+    const auto ensures = find_site(stats, ensures_site);
+    REQUIRE(ensures != nullptr);
+    CHECK(ensures->hits == 6);
+    CHECK(std::strcmp(ensures->type, "Postcondition") == 0);
+}
+
+TEST_CASE("sorted_by_hits")
+{
+    contract_profile_reset();
+
+    int arr[4] = {1, 2, 3, 4};
+    const span<int> s{arr};
+    int sum = 0;
+    for (span<int>::index_type i = 0; i < s.size(); ++i) sum += s[i];
+    CHECK(sum == 10);
+    checked(1);
+
+    const auto stats = contract_profile_snapshot();
+    REQUIRE(!stats.empty());
+    for (std::size_t i = 1; i < stats.size(); ++i) CHECK(stats[i - 1].hits >= stats[i].hits);
+
+    // span::operator[] is the hottest site
+    CHECK(stats.front().hits >= 4);
+    CHECK(std::strstr(stats.front().file.c_str(), "span") != nullptr);
+}
+
+TEST_CASE("reset")
+{
+    checked(1);
+    contract_profile_reset();
+
+    for (const auto& s : contract_profile_snapshot()) CHECK(s.hits == 0);
+}
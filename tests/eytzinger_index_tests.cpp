@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/eytzinger_index> // for eytzinger_index
+#include <gsl/span>            // for span
+
+#include <algorithm>  // for lower_bound, upper_bound, binary_search
+#include <cstddef>    // for ptrdiff_t, size_t
+#include <cstdint>    // for int64_t
+#include <functional> // for greater
+#include <utility>    // for move
+#include <vector>     // for vector
+
+using namespace std;
+using namespace gsl;
+
+TEST_CASE("eytzinger_index_matches_std")
+{
+    for (int n = 0; n < 300; ++n)
+    {
+        // even keys, with every fourth one repeated
+        std::vector<int> keys;
+        for (int i = 0; i < n; ++i)
+        {
+            keys.push_back(2 * i);
+            if (i % 4 == 0) keys.push_back(2 * i);
+        }
+        const eytzinger_index<int> index(keys);
+        REQUIRE(index.size() == static_cast<std::ptrdiff_t>(keys.size()));
+
+        for (int key = -1; key <= 2 * n + 1; ++key)
+        {
+            const auto lower = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+            const auto upper = std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+            CHECK(index.lower_bound(key) == lower);
+            CHECK(index.upper_bound(key) == upper);
+            CHECK(index.contains(key) == std::binary_search(keys.begin(), keys.end(), key));
+        }
+    }
+}
+
+TEST_CASE("eytzinger_index_comparator")
+{
+    const std::vector<std::int64_t> keys = {90, 70, 70, 50, 10};
+    const eytzinger_index<std::int64_t, std::greater<>> index(keys);
+
+    CHECK(index.lower_bound(100) == 0);
+    CHECK(index.lower_bound(70) == 1);
+    CHECK(index.upper_bound(70) == 3);
+    CHECK(index.lower_bound(20) == 4);
+    CHECK(index.lower_bound(5) == 5);
+    CHECK(index.contains(50));
+    CHECK(!index.contains(60));
+
+    // heterogeneous keys go through the comparator
+    CHECK(index.lower_bound(69.5) == 3);
+}
+
+TEST_CASE("eytzinger_index_empty_and_move")
+{
+    const eytzinger_index<double> empty;
+    CHECK(empty.empty());
+    CHECK(empty.lower_bound(1.0) == 0);
+    CHECK(!empty.contains(1.0));
+
+    const double values[] = {0.5, 1.5, 2.5};
+    eytzinger_index<double> index{span<const double>(values)};
+    eytzinger_index<double> moved = std::move(index);
+    CHECK(moved.size() == 3);
+    CHECK(moved.lower_bound(2.0) == 2);
+    CHECK(moved.contains(1.5));
+
+    const eytzinger_index<double> copy = moved;
+    CHECK(copy.size() == 3);
+    CHECK(copy.lower_bound(2.0) == 2);
+    CHECK(copy.upper_bound(2.5) == 3);
+    CHECK(copy.contains(0.5));
+
+    eytzinger_index<double> assigned;
+    assigned = copy;
+    CHECK(assigned.lower_bound(1.0) == 1);
+    assigned = empty;
+    CHECK(assigned.empty());
+    CHECK(!assigned.contains(0.5));
+}
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/intern_pool> // for intern_pool, concurrent_intern_pool
+#include <gsl/string_span> // for cstring_span
+
+#include <cstring> // for strlen
+#include <string>  // for string, to_string
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+using namespace std;
+using namespace gsl;
+
+TEST_CASE("intern")
+{
+    intern_pool pool;
+    CHECK(pool.empty());
+    CHECK(pool.find("config") == intern_pool::npos);
+
+    const auto a = pool.intern("config");
+    const auto b = pool.intern("tag");
+    std::string copy = "config";
+    const auto c = pool.intern(copy);
+    CHECK(a == c);
+    CHECK(a != b);
+    CHECK(pool.size() == 2);
+    CHECK(pool.find("tag") == b);
+
+    // the pool keeps its own null terminated copy
+    copy[0] = 'X';
+    CHECK(pool.str(a) == "config");
+    CHECK(pool.str(a).data()[6] == '\0');
+    CHECK(pool.str(a).data() != copy.data());
+
+    // the empty string and embedded nulls are strings like any other
+    const auto e = pool.intern(cstring_span<>());
+    CHECK(pool.str(e).empty());
+    const char with_null[] = {'a', '\0', 'b'};
+    const auto n = pool.intern(cstring_span<>(with_null, 3));
+    CHECK(n != pool.intern("a"));
+    CHECK(pool.str(n).size() == 3);
+
+    CHECK_THROWS_AS(pool.str(100), fail_fast);
+}
+
+TEST_CASE("views_are_stable")
+{
+    intern_pool pool;
+    std::vector<cstring_span<>> views;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::string s = "key_" + std::to_string(i);
+        const auto id = pool.intern(s);
+        CHECK(id == static_cast<intern_pool::id_type>(i));
+        views.push_back(pool.str(id));
+    }
+
+    // a string longer than an arena block
+    const std::string big(100000, 'x');
+    const auto big_id = pool.intern(big);
+    CHECK(pool.str(big_id) == big);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::string s = "key_" + std::to_string(i);
+        CHECK(views[static_cast<std::size_t>(i)] == s);
+        CHECK(pool.intern(s) == static_cast<intern_pool::id_type>(i));
+    }
+    CHECK(pool.size() == 20001);
+    CHECK(pool.arena_bytes() >= 100001);
+
+    intern_pool moved = std::move(pool);
+    CHECK(moved.find("key_123") == 123);
+    CHECK(views[123] == "key_123");
+}
+
+TEST_CASE("concurrent")
+{
+    concurrent_intern_pool pool;
+    constexpr int thread_count = 4;
+    constexpr int strings = 5000;
+    std::vector<std::vector<concurrent_intern_pool::id_type>> ids(thread_count);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&pool, &ids, t] {
+            // every thread interns the same strings in a different order
+            for (int i = 0; i < strings; ++i)
+            {
+                const int k = (i * (t + 1) * 7919) % strings;
+                ids[static_cast<std::size_t>(t)].push_back(
+                    pool.intern("value_" + std::to_string(k)));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    CHECK(pool.size() == strings);
+    for (int t = 0; t < thread_count; ++t)
+    {
+        for (int i = 0; i < strings; ++i)
+        {
+            const int k = (i * (t + 1) * 7919) % strings;
+            const auto id = ids[static_cast<std::size_t>(t)][static_cast<std::size_t>(i)];
+            CHECK(pool.find("value_" + std::to_string(k)) == id);
+            CHECK(pool.str(id) == "value_" + std::to_string(k));
+        }
+    }
+    CHECK(pool.find("missing") == concurrent_intern_pool::npos);
+
+    CHECK_THROWS_AS(concurrent_intern_pool(-1), fail_fast);
+    CHECK_THROWS_AS(concurrent_intern_pool(9), fail_fast);
+    CHECK_THROWS_AS(concurrent_intern_pool(64), fail_fast);
+}
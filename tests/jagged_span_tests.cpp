@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/jagged_span> // for jagged_span, jagged_buffer
+#include <gsl/span>        // for span
+
+#include <algorithm> // for find_if
+#include <cstddef>   // for ptrdiff_t
+#include <iterator>  // for advance, distance
+#include <string>    // for string
+#include <vector>    // for vector
+
+using namespace std;
+using namespace gsl;
+
+TEST_CASE("construction_and_indexing")
+{
+    int values[] = {1, 2, 3, 4, 5, 6};
+    const std::ptrdiff_t offsets[] = {0, 2, 2, 5, 6};
+    const jagged_span<int> rows(values, offsets);
+
+    REQUIRE(rows.size() == 4);
+    CHECK(rows[0].size() == 2);
+    CHECK(rows[0][1] == 2);
+    CHECK(rows[1].empty());
+    CHECK(rows[2].size() == 3);
+    CHECK(rows[2].data() == values + 2);
+    CHECK(rows[3][0] == 6);
+
+    rows[2][0] = 30;
+    CHECK(values[2] == 30);
+
+    CHECK_THROWS_AS(rows[4], fail_fast);
+    CHECK_THROWS_AS(rows[-1], fail_fast);
+
+    const jagged_span<const int> c = rows;
+    CHECK(c.size() == 4);
+    CHECK(c[2][0] == 30);
+    CHECK(c.values().size() == 6);
+    CHECK(c.offsets().size() == 5);
+
+    const jagged_span<int> empty;
+    CHECK(empty.empty());
+    CHECK(empty.begin() == empty.end());
+    const jagged_span<int> no_rows(values, span<const std::ptrdiff_t>(offsets, 1));
+    CHECK(no_rows.empty());
+}
+
+TEST_CASE("invalid_offsets")
+{
+    int values[] = {1, 2, 3};
+    const std::ptrdiff_t decreasing[] = {0, 2, 1, 3};
+    const std::ptrdiff_t past_end[] = {0, 2, 4};
+    const std::ptrdiff_t negative[] = {-1, 2};
+    CHECK_THROWS_AS(jagged_span<int>(values, decreasing), fail_fast);
+    CHECK_THROWS_AS(jagged_span<int>(values, past_end), fail_fast);
+    CHECK_THROWS_AS(jagged_span<int>(values, negative), fail_fast);
+
+    // values outside the first and last offset belong to no row
+    const std::ptrdiff_t inner[] = {1, 2};
+    const jagged_span<int> middle(values, inner);
+    REQUIRE(middle.size() == 1);
+    CHECK(middle[0][0] == 2);
+}
+
+TEST_CASE("iteration")
+{
+    const std::string values = "onetwothree";
+    const std::ptrdiff_t offsets[] = {0, 3, 6, 11};
+    const jagged_span<const char> words(values, offsets);
+
+    std::vector<std::string> seen;
+    for (const auto word : words) seen.emplace_back(word.begin(), word.end());
+    CHECK(seen == std::vector<std::string>{"one", "two", "three"});
+
+    auto it = words.begin();
+    CHECK((*(it + 2)).size() == 5);
+    CHECK(it[1][0] == 't');
+    CHECK(words.end() - it == 3);
+    ++it;
+    CHECK((*it)[0] == 't');
+    CHECK(it < words.end());
+
+    // the rest of the random access iterator requirements
+    CHECK((*(1 + it)).size() == 5);
+    it -= 1;
+    CHECK(it == words.begin());
+    CHECK(it <= words.begin());
+    CHECK(it >= words.begin());
+    CHECK(words.end() > it);
+    CHECK(!(words.end() <= it));
+    CHECK(std::distance(words.begin(), words.end()) == 3);
+    std::advance(it, 3);
+    CHECK(it == words.end());
+    CHECK(std::find_if(words.begin(), words.end(), [](span<const char> w) {
+              return w.size() == 5;
+          }) == words.begin() + 2);
+}
+
+TEST_CASE("jagged_buffer")
+{
+    jagged_buffer<int> adjacency;
+    adjacency.reserve(3, 8);
+    CHECK(adjacency.empty());
+
+    const std::vector<int> first{1, 2};
+    adjacency.add_row(span<const int>(first));
+    adjacency.end_row();
+    adjacency.push_back(0);
+    adjacency.push_back(1);
+    adjacency.push_back(3);
+    adjacency.end_row();
+
+    // an open row is not part of the span
+    adjacency.push_back(7);
+    CHECK(adjacency.size() == 3);
+
+    const auto rows = adjacency.as_span();
+    REQUIRE(rows.size() == 3);
+    CHECK(rows[0].size() == 2);
+    CHECK(rows[1].empty());
+    CHECK(rows[2][2] == 3);
+    rows[2][2] = 4;
+
+    const jagged_buffer<int>& cref = adjacency;
+    const jagged_span<const int> crows = cref.as_span();
+    CHECK(crows[2][2] == 4);
+
+    adjacency.end_row();
+    CHECK(adjacency.as_span()[3][0] == 7);
+
+    adjacency.clear();
+    CHECK(adjacency.empty());
+    CHECK(adjacency.as_span().empty());
+    adjacency.add_row(span<const int>(first));
+    CHECK(adjacency.as_span()[0][1] == 2);
+}
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/k_way_merger> // for k_way_merger, merge_k
+#include <gsl/span>         // for span
+
+#include <algorithm>  // for sort, stable_sort, min
+#include <cstddef>    // for ptrdiff_t, size_t
+#include <functional> // for greater
+#include <vector>     // for vector
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+struct record
+{
+    int key;
+    int run;
+};
+
+bool operator==(const record& l, const record& r) { return l.key == r.key && l.run == r.run; }
+
+const auto by_key = [](const record& l, const record& r) { return l.key < r.key; };
+} // namespace
+
+TEST_CASE("merge_k")
+{
+    for (std::size_t k = 0; k < 20; ++k)
+    {
+        // runs of different lengths with keys repeated within and across runs
+        std::vector<std::vector<record>> storage(k);
+        std::vector<record> expected;
+        for (std::size_t r = 0; r < k; ++r)
+        {
+            const auto run = static_cast<int>(r);
+            for (int i = 0; i < (run * 7) % 11; ++i) storage[r].push_back({i * (run % 3 + 1), run});
+            expected.insert(expected.end(), storage[r].begin(), storage[r].end());
+        }
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+
+        std::vector<span<const record>> runs(storage.begin(), storage.end());
+        std::vector<record> out(expected.size());
+        CHECK(merge_k(span<const span<const record>>(runs), span<record>(out), by_key) ==
+              static_cast<std::ptrdiff_t>(expected.size()));
+        CHECK(out == expected);
+    }
+}
+
+TEST_CASE("k_way_merger_batches")
+{
+    const std::vector<int> a{1, 4, 9, 16, 25};
+    const std::vector<int> b{2, 3, 5, 7, 11, 13, 17};
+    const std::vector<int> c{};
+    const std::vector<int> d{0, 100};
+    const span<const int> runs[] = {a, b, c, d};
+
+    std::vector<int> expected;
+    for (const auto run : runs) expected.insert(expected.end(), run.begin(), run.end());
+    std::sort(expected.begin(), expected.end());
+
+    k_way_merger<int> merger{span<const span<const int>>(runs)};
+    CHECK(merger.size() == 4);
+    CHECK(merger.remaining() == 14);
+
+    std::vector<int> merged;
+    int batch[3];
+    while (!merger.done())
+    {
+        const auto n = merger.next(span<int>(batch));
+        CHECK(n == (std::min)(std::ptrdiff_t{3}, 14 - static_cast<std::ptrdiff_t>(merged.size())));
+        merged.insert(merged.end(), batch, batch + n);
+    }
+    CHECK(merged == expected);
+    CHECK(merger.next(span<int>(batch)) == 0);
+
+    // in descending order
+    const std::vector<int> down1{9, 5, 1};
+    const std::vector<int> down2{8, 7, 6};
+    const span<const int> down[] = {down1, down2};
+    int out[6];
+    CHECK(merge_k(span<const span<const int>>(down), span<int>(out), std::greater<>()) == 6);
+    CHECK(std::vector<int>(out, out + 6) == std::vector<int>{9, 8, 7, 6, 5, 1});
+
+    int too_short[5];
+    CHECK_THROWS_AS(merge_k(span<const span<const int>>(down), span<int>(too_short)), fail_fast);
+}
+
+TEST_CASE("k_way_merger_refill")
+{
+    for (std::ptrdiff_t k = 0; k < 12; ++k)
+    {
+        for (const std::size_t batch_size : {1u, 2u, 5u, 64u})
+        {
+            // runs of different lengths with keys repeated within and across runs
+            std::vector<std::vector<record>> storage(static_cast<std::size_t>(k));
+            std::vector<record> expected;
+            for (std::size_t r = 0; r < storage.size(); ++r)
+            {
+                const auto run = static_cast<int>(r);
+                for (int i = 0; i < (run * 5) % 13; ++i)
+                    storage[r].push_back({i * (run % 4 + 1), run});
+                expected.insert(expected.end(), storage[r].begin(), storage[r].end());
+            }
+            std::stable_sort(expected.begin(), expected.end(), by_key);
+
+            // hands out every run batch_size elements at a time through a buffer of its
+            // own, which is overwritten on the next refill of the run
+            std::vector<std::size_t> positions(storage.size());
+            std::vector<std::vector<record>> buffers(storage.size());
+            std::ptrdiff_t refills = 0;
+            const auto refill = [&](std::ptrdiff_t run) {
+                const auto r = static_cast<std::size_t>(run);
+                const auto n = (std::min)(batch_size, storage[r].size() - positions[r]);
+                buffers[r].assign(storage[r].begin() + static_cast<std::ptrdiff_t>(positions[r]),
+                                  storage[r].begin() +
+                                      static_cast<std::ptrdiff_t>(positions[r] + n));
+                positions[r] += n;
+                ++refills;
+                return span<const record>(buffers[r].data(), static_cast<std::ptrdiff_t>(n));
+            };
+
+            k_way_merger<record, decltype(by_key)> merger(k, refill, by_key);
+            CHECK(merger.size() == k);
+            CHECK(refills == k);
+
+            std::vector<record> merged;
+            record batch[3];
+            while (!merger.done())
+            {
+                const auto n = merger.next(span<record>(batch));
+                merged.insert(merged.end(), batch, batch + n);
+            }
+            CHECK(merged == expected);
+            CHECK(merger.remaining() == 0);
+            CHECK(merger.next(span<record>(batch)) == 0);
+        }
+    }
+
+    CHECK_THROWS_AS(k_way_merger<int>(-1, [](std::ptrdiff_t) { return span<const int>(); }),
+                    fail_fast);
+    CHECK_THROWS_AS(k_way_merger<int>(1, nullptr), fail_fast);
+}
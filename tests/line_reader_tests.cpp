@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/line_reader> // for line_reader
+#include <gsl/span>        // for span
+#include <gsl/string_span> // for cstring_span, to_string
+
+#include <algorithm> // for min, copy_n
+#include <cstddef>   // for ptrdiff_t, size_t
+#include <cstdio>    // for FILE, tmpfile, fwrite, rewind, fclose
+#include <memory>    // for make_shared
+#include <string>    // for string
+#include <utility>   // for move
+#include <vector>    // for vector
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+std::vector<std::string> read_all(line_reader& reader)
+{
+    std::vector<std::string> lines;
+    cstring_span<> line;
+    while (reader.next(line)) lines.push_back(gsl::to_string(line));
+    CHECK(!reader.next(line));
+    return lines;
+}
+
+// a source that hands out at most chunk characters of text per call
+line_reader::source_type chunked(const std::string& text, std::ptrdiff_t chunk)
+{
+    auto pos = std::make_shared<std::size_t>(0);
+    return [&text, chunk, pos](span<char> buffer) {
+        const auto n = (std::min)({static_cast<std::size_t>(chunk),
+                                   static_cast<std::size_t>(buffer.size()), text.size() - *pos});
+        std::copy_n(text.data() + *pos, n, buffer.data());
+        *pos += n;
+        return static_cast<std::ptrdiff_t>(n);
+    };
+}
+} // namespace
+
+TEST_CASE("lines_in_memory")
+{
+    const char text[] = "first\n\nthird line\r\nlast";
+    line_reader reader{cstring_span<>(text)};
+
+    cstring_span<> line;
+    REQUIRE(reader.next(line));
+    CHECK(line == "first");
+    CHECK(line.data() == text);
+    REQUIRE(reader.next(line));
+    CHECK(line.empty());
+    REQUIRE(reader.next(line));
+    CHECK(line == "third line\r");
+    REQUIRE(reader.next(line));
+    CHECK(line == "last");
+    CHECK(!reader.next(line));
+
+    line_reader trailing{cstring_span<>("a\nb\n")};
+    CHECK(read_all(trailing) == std::vector<std::string>{"a", "b"});
+
+    line_reader empty{cstring_span<>{}};
+    CHECK(read_all(empty).empty());
+}
+
+TEST_CASE("lines_straddling_refills")
+{
+    std::string text;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 60; ++i)
+    {
+        expected.push_back(std::string(static_cast<std::size_t>(i * 7 % 23), static_cast<char>('a' + i % 26)));
+        text += expected.back() + '\n';
+    }
+    expected.push_back("no newline at the end");
+    text += expected.back();
+
+    for (const std::ptrdiff_t buffer_size : {1, 4, 16, 64, 4096})
+    {
+        for (const std::ptrdiff_t chunk : {1, 3, 7, 100})
+        {
+            line_reader reader(chunked(text, chunk), buffer_size);
+            CHECK(read_all(reader) == expected);
+        }
+    }
+}
+
+TEST_CASE("lines_from_file")
+{
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    const std::string text = "one\ntwo\nthree\n";
+    std::fwrite(text.data(), 1, text.size(), file);
+    std::rewind(file);
+
+    line_reader reader(file, 5);
+    CHECK(read_all(reader) == std::vector<std::string>{"one", "two", "three"});
+    std::fclose(file);
+
+    CHECK_THROWS_AS(line_reader(static_cast<std::FILE*>(nullptr)), fail_fast);
+    CHECK_THROWS_AS(line_reader(chunked(text, 1), 0), fail_fast);
+
+    // default_buffer_size can be bound to a reference
+    const std::ptrdiff_t& default_size = line_reader::default_buffer_size;
+    CHECK((std::min)(std::ptrdiff_t{5}, line_reader::default_buffer_size) == 5);
+    CHECK(default_size == 64 * 1024);
+}
+
+TEST_CASE("line_reader_move")
+{
+    const std::string text = "x\ny\nz";
+    line_reader reader(chunked(text, 2), 8);
+    cstring_span<> line;
+    REQUIRE(reader.next(line));
+    CHECK(line == "x");
+
+    line_reader moved = std::move(reader);
+    REQUIRE(moved.next(line));
+    CHECK(line == "y");
+    REQUIRE(moved.next(line));
+    CHECK(line == "z");
+    CHECK(!moved.next(line));
+}
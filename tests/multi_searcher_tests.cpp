@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/multi_searcher> // for multi_searcher, multi_match
+#include <gsl/string_span>    // for cstring_span
+
+#include <algorithm> // for sort
+#include <cstddef>   // for ptrdiff_t, size_t
+#include <string>    // for string
+#include <utility>   // for pair
+#include <vector>    // for vector
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+using match_list = std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>>;
+
+match_list all_matches(const multi_searcher& searcher, cstring_span<> text)
+{
+    match_list matches;
+    searcher.for_each_match(
+        text, [&](multi_match m) { matches.emplace_back(m.pattern, m.offset); });
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+// every occurrence found by looking for each pattern at each offset
+match_list naive_matches(const std::vector<cstring_span<>>& patterns, const std::string& text)
+{
+    match_list matches;
+    for (std::size_t p = 0; p < patterns.size(); ++p)
+    {
+        const std::string pattern = gsl::to_string(patterns[p]);
+        for (auto pos = text.find(pattern); pos != std::string::npos;
+             pos = text.find(pattern, pos + 1))
+            matches.emplace_back(static_cast<std::ptrdiff_t>(p),
+                                 static_cast<std::ptrdiff_t>(pos));
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+} // namespace
+
+TEST_CASE("classic_example")
+{
+    const std::vector<cstring_span<>> patterns = {"he", "she", "his", "hers"};
+    const multi_searcher searcher(patterns);
+    CHECK(searcher.size() == 4);
+
+    const cstring_span<> text = "ushers";
+    CHECK(all_matches(searcher, text) == match_list{{0, 2}, {1, 1}, {3, 2}});
+
+    // the first match to end, the longest of those ending together
+    const auto first = searcher.find(text);
+    CHECK(first.pattern == 1);
+    CHECK(first.offset == 1);
+
+    CHECK(searcher.contains(text));
+    CHECK(!searcher.contains("nothing to see"));
+    const auto none = searcher.find("nothing to see");
+    CHECK(none.pattern == -1);
+    CHECK(none.offset == 14);
+}
+
+TEST_CASE("matches_agree_with_naive_search")
+{
+    const std::vector<cstring_span<>> patterns = {"error", "err",   "or",    "warn", "warning",
+                                                  "a",     "aaa",   "fatal", "tal",  "\xff\xfe",
+                                                  "err",   "ror e", "g: "};
+    const multi_searcher searcher(patterns);
+
+    const std::string text = "warning: error in fatal terror, aaaa; error error \xff\xfe\xff "
+                             "warnin err";
+    CHECK(all_matches(searcher, text) == naive_matches(patterns, text));
+
+    // the same text in pieces
+    for (std::size_t length = 0; length < text.size(); length += 5)
+    {
+        const auto part = text.substr(0, length);
+        CHECK(all_matches(searcher, part) == naive_matches(patterns, part));
+    }
+}
+
+TEST_CASE("single_start_character")
+{
+    // every pattern starts with '[', the start state is skipped with memchr
+    const std::vector<cstring_span<>> patterns = {"[ERROR]", "[WARN]", "[E"};
+    const multi_searcher searcher(patterns);
+
+    const std::string text = "12:00 [INFO] ok\n12:01 [WARN] disk\n12:02 [ERROR] down [E";
+    CHECK(all_matches(searcher, text) == naive_matches(patterns, text));
+    CHECK(searcher.find(text).pattern == 1);
+    CHECK(!searcher.contains("[INFO] [WAR"));
+}
+
+TEST_CASE("edge_cases")
+{
+    const multi_searcher empty(span<const cstring_span<>>{});
+    CHECK(empty.size() == 0);
+    CHECK(!empty.contains("anything"));
+
+    const std::vector<cstring_span<>> patterns = {"x"};
+    const multi_searcher searcher(patterns);
+    CHECK(!searcher.contains(cstring_span<>{}));
+    CHECK(searcher.find("..x").offset == 2);
+
+    const std::vector<cstring_span<>> with_empty = {"a", ""};
+    CHECK_THROWS_AS(multi_searcher(with_empty), fail_fast);
+}
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/gsl_byte>    // for byte, to_byte
+#include <gsl/padded_span> // for padded_span, padded_buffer, find
+#include <gsl/span>        // for span
+
+#include <cstddef> // for ptrdiff_t
+#include <cstring> // for memcpy
+
+using namespace std;
+using namespace gsl;
+
+TEST_CASE("construction")
+{
+    char buf[24] = "hello, world";
+
+    {
+        const padded_span<char, 8> s(span<char>(buf), 12);
+        CHECK(s.size() == 12);
+        CHECK(s.size_bytes() == 12);
+        CHECK(s.data() == buf);
+        CHECK(s.buffer().size() == 24);
+        CHECK(s.as_span().size() == 12);
+        CHECK(s[4] == 'o');
+        CHECK_THROWS_AS(s[12], fail_fast);
+    }
+
+    {
+        const padded_span<char, 12> s(buf, 12, 24);
+        CHECK(s.size() == 12);
+
+        // less padding is fine
+        const padded_span<const char, 4> weaker = s;
+        CHECK(weaker.size() == 12);
+
+        // to exactly span_type, through span's container constructor alone
+        padded_span<const char, 7> m(buf, 12, 24);
+        const span<const char> exact = m;
+        CHECK(exact.size() == 12);
+        const span<const char> elements = weaker.as_span();
+        CHECK(elements.data() == buf);
+    }
+
+    {
+        const padded_span<char, 8> s;
+        CHECK(s.empty());
+
+        // empty spans need no padding
+        const padded_span<char, 8> e(buf, 0, 0);
+        CHECK(e.empty());
+    }
+
+    // not enough padding
+    CHECK_THROWS_AS((padded_span<char, 13>(buf, 12, 24)), fail_fast);
+    CHECK_THROWS_AS((padded_span<char, 8>(buf, 20, 24)), fail_fast);
+    CHECK_THROWS_AS((padded_span<char, 8>(buf, 25, 24)), fail_fast);
+    CHECK_THROWS_AS((padded_span<char, 8>(buf, -1, 24)), fail_fast);
+
+    // padding is counted in bytes
+    {
+        int ints[6] = {};
+        const padded_span<int, 8> s(ints, 4, 6);
+        CHECK(s.size() == 4);
+        CHECK_THROWS_AS((padded_span<int, 9>(ints, 4, 6)), fail_fast);
+    }
+}
+
+TEST_CASE("subviews")
+{
+    char buf[24] = "hello, world";
+    const padded_span<char, 8> s(buf, 12, 24);
+
+    const auto suffix = s.subspan(7);
+    CHECK(suffix.size() == 5);
+    CHECK(suffix[0] == 'w');
+    CHECK(suffix.buffer().size() == 17);
+
+    const auto prefix = s.first(5);
+    CHECK(prefix.size() == 5);
+    CHECK(prefix.buffer().size() == 24);
+
+    CHECK(s.subspan(12).empty());
+    CHECK_THROWS_AS(s.subspan(13), fail_fast);
+    CHECK_THROWS_AS(s.first(13), fail_fast);
+
+    std::ptrdiff_t count = 0;
+    for (const char c : prefix)
+    {
+        CHECK(c == buf[count]);
+        ++count;
+    }
+    CHECK(count == 5);
+
+    // the iterators stop at the elements, the padding is only reachable through buffer()
+    CHECK(prefix.end() - prefix.begin() == 5);
+    CHECK_THROWS_AS(*prefix.end(), fail_fast);
+    CHECK_THROWS_AS(prefix.begin()[5], fail_fast);
+    CHECK_THROWS_AS(*s.cend(), fail_fast);
+}
+
+TEST_CASE("buffer")
+{
+    padded_buffer<char, 31> buf;
+    CHECK(buf.empty());
+    CHECK(buf.as_span().empty());
+
+    buf.resize(5);
+    std::memcpy(buf.data(), "abcde", 5);
+    CHECK(buf.size() == 5);
+    CHECK(buf.as_span().buffer().size() >= 5 + 31);
+
+    buf.resize(100);
+    CHECK(buf.size() == 100);
+    CHECK(buf.as_span()[0] == 'a');
+    CHECK(buf.as_span()[4] == 'e');
+    CHECK(buf.as_span()[99] == '\0');
+
+    buf.resize(3);
+    buf.resize(4);
+    CHECK(buf.as_span()[3] == '\0');
+
+    const auto& cbuf = buf;
+    const padded_span<const char, 31> cs = cbuf.as_span();
+    CHECK(cs.size() == 4);
+
+    CHECK_THROWS_AS(buf.resize(-1), fail_fast);
+
+    padded_buffer<int, 16> ints(10);
+    CHECK(ints.as_span().buffer().size() >= 14);
+}
+
+TEST_CASE("find")
+{
+    padded_buffer<char, 7> buf(40);
+    for (std::ptrdiff_t i = 0; i < 40; ++i) buf.data()[i] = static_cast<char>('a' + i % 26);
+
+    const auto s = buf.as_span();
+    CHECK(find(s, 'a') == 0);
+    CHECK(find(s, 'h') == 7);
+    CHECK(find(s, 'i') == 8);
+    CHECK(find(s, 'z') == 25);
+    CHECK(find(s.subspan(1), 'a') == 25);
+    CHECK(find(s, '!') == 40);
+
+    // matches in the padding are not reported
+    CHECK(find(s.first(5), 'f') == 5);
+    CHECK(find(s.first(0), 'a') == 0);
+
+    padded_buffer<byte, 8> bytes(3);
+    bytes.data()[2] = to_byte<0x7f>();
+    CHECK(find(bytes.as_span(), to_byte<0x7f>()) == 2);
+    CHECK(find(bytes.as_span(), to_byte<0xff>()) == 3);
+}
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/gsl_assert> // for HotExpects, Expects, set_contract_sample_rate
+#include <gsl/span>       // for span
+
+using namespace gsl;
+
+namespace
+{
+int hot(int i)
+{
+    HotExpects(i > 0 && i < 10);
+    return i;
+}
+
+// makes the next hot check on this thread an evaluated one
+void restart_sampling(unsigned rate)
+{
+    set_contract_sample_rate(1);
+    hot(1);
+    set_contract_sample_rate(rate);
+}
+} // namespace
+
+TEST_CASE("default_rate")
+{
+    CHECK(get_contract_sample_rate() == GSL_CONTRACT_SAMPLE_RATE);
+    CHECK_THROWS_AS(set_contract_sample_rate(0), fail_fast);
+}
+
+TEST_CASE("hot_checks_are_sampled")
+{
+    restart_sampling(4);
+
+    int failures = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        try
+        {
+            hot(42);
+        }
+        catch (const fail_fast&)
+        {
+            ++failures;
+        }
+    }
+    CHECK(failures == 2);
+
+    restart_sampling(1);
+    for (int i = 0; i < 8; ++i) CHECK_THROWS_AS(hot(42), fail_fast);
+}
+
+TEST_CASE("span_subscript_is_sampled")
+{
+    int arr[16] = {};
+    const span<int> s{arr, 4};
+
+    restart_sampling(8);
+    CHECK_THROWS_AS(s[8], fail_fast);
+    for (int i = 0; i < 7; ++i) CHECK_NOTHROW(s[8]);
+    CHECK_THROWS_AS(s[8], fail_fast);
+}
+
+TEST_CASE("cold_checks_are_not_sampled")
+{
+    int arr[4] = {};
+    const span<int> s{arr};
+
+    restart_sampling(1000);
+    for (int i = 0; i < 8; ++i) CHECK_THROWS_AS(s.first(5), fail_fast);
+}
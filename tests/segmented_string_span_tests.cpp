@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+// blanket turn off warnings from CppCoreCheck from catch
+// so people aren't annoyed by them when running the tool.
+#pragma warning(disable : 26440 26426) // from catch
+#endif
+
+#include <catch/catch.hpp> // for AssertionHandler, StringRef, CHECK, CHECK...
+
+#include <gsl/segmented_string_span> // for segmented_string_span, csegmented_string_span
+#include <gsl/span>                  // for span
+#include <gsl/string_span>           // for cstring_span
+
+#include <cstddef>  // for ptrdiff_t, size_t
+#include <iterator> // for distance
+#include <string>   // for string
+#include <vector>   // for vector
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+struct buffer
+{
+    void* base;
+    std::size_t length;
+};
+
+std::string flatten(const csegmented_string_span& s)
+{
+    std::string out(static_cast<std::size_t>(s.size()), '\0');
+    s.copy_to(span<char>(&out[0], s.size()));
+    return out;
+}
+} // namespace
+
+TEST_CASE("construction_and_indexing")
+{
+    const std::string cached = "Content-Type: text/plain\r\n";
+    csegmented_string_span s{"HTTP/1.1 200 OK\r\n", cached, "", "\r\nhello"};
+    CHECK(s.size() == 17 + 26 + 7);
+    CHECK(s.segments().size() == 3);
+    CHECK(s[0] == 'H');
+    CHECK(s[17] == 'C');
+    CHECK(s[s.size() - 1] == 'o');
+    CHECK(&s[17] == cached.data());
+    CHECK_THROWS_AS(s[s.size()], fail_fast);
+    CHECK_THROWS_AS(s[-1], fail_fast);
+
+    const csegmented_string_span empty;
+    CHECK(empty.empty());
+    CHECK(empty.begin() == empty.end());
+
+    char a[] = "ab";
+    char b[] = "cd";
+    segmented_string_span m;
+    m.append(a).append(b);
+    m[2] = 'X';
+    CHECK(b[0] == 'X');
+}
+
+TEST_CASE("iteration")
+{
+    const csegmented_string_span s{"ab", "c", "def"};
+    std::string collected;
+    for (const char c : s) collected += c;
+    CHECK(collected == "abcdef");
+    CHECK(std::distance(s.begin(), s.end()) == 6);
+
+    auto it = s.end();
+    --it;
+    CHECK(*it == 'f');
+    std::advance(it, -3);
+    CHECK(*it == 'c');
+    --it;
+    CHECK(*it == 'b');
+}
+
+TEST_CASE("find")
+{
+    const csegmented_string_span s{"abc", "de", "f", "abcdef"};
+
+    CHECK(s.find("abc") == 0);
+    CHECK(s.find("abc", 1) == 6);
+    CHECK(s.find("cdef") == 2);
+    CHECK(s.find("bcdefa") == 1);
+    CHECK(s.find("f") == 5);
+    CHECK(s.find("fa") == 5);
+    CHECK(s.find("def", 4) == 9);
+    CHECK(s.find("xyz") == s.size());
+    CHECK(s.find("abcdefabcdefg") == s.size());
+    CHECK(s.find("") == 0);
+    CHECK(s.find("", 12) == 12);
+    CHECK(s.find("a", 12) == 12);
+    CHECK_THROWS_AS(s.find("a", 13), fail_fast);
+
+    // agrees with a flat string for every needle
+    const std::string flat = flatten(s);
+    for (std::size_t pos = 0; pos < flat.size(); ++pos)
+    {
+        for (std::size_t len = 1; pos + len <= flat.size(); ++len)
+        {
+            const std::string needle = flat.substr(pos, len);
+            CHECK(s.find(needle) == static_cast<std::ptrdiff_t>(flat.find(needle)));
+        }
+    }
+
+    char a[] = "xab";
+    char b[] = "cab";
+    segmented_string_span m;
+    m.append(a).append(b);
+    CHECK(m.find("bc") == 2);
+    CHECK(m.find("ab", 2) == 4);
+    CHECK(m.find("ba") == m.size());
+}
+
+TEST_CASE("remove_prefix_and_buffers")
+{
+    csegmented_string_span s{"0123", "45", "6789"};
+
+    buffer buffers[8];
+    CHECK(s.to_buffers(span<buffer>(buffers)) == 3);
+    CHECK(buffers[1].length == 2);
+    CHECK(static_cast<const char*>(buffers[1].base)[0] == '4');
+    CHECK(s.to_buffers(span<buffer>(buffers, 2)) == 2);
+
+    // as after a partial write of five bytes
+    s.remove_prefix(5);
+    CHECK(s.size() == 5);
+    CHECK(flatten(s) == "56789");
+    CHECK(s[0] == '5');
+    CHECK(s.find("67") == 1);
+    CHECK(s.segments().size() == 2);
+    CHECK(s.to_buffers(span<buffer>(buffers)) == 2);
+    CHECK(buffers[0].length == 1);
+
+    s.remove_prefix(1);
+    CHECK(flatten(s) == "6789");
+    CHECK(s.segments().size() == 1);
+
+    s.remove_prefix(4);
+    CHECK(s.empty());
+    CHECK(s.begin() == s.end());
+    CHECK_THROWS_AS(s.remove_prefix(1), fail_fast);
+
+    s.append("xy");
+    CHECK(flatten(s) == "xy");
+    CHECK(s[1] == 'y');
+
+    char small[1];
+    CHECK_THROWS_AS(s.copy_to(small), fail_fast);
+}
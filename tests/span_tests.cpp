@@ -28,6 +28,7 @@
 #include <gsl/span>     // for span, span_iterator, operator==, operator!=
 
 #include <array>       // for array
+#include <cstdint>     // for int16_t, int32_t, uint32_t
 #include <iostream>    // for ptrdiff_t
 #include <iterator>    // for reverse_iterator, operator-, operator==
 #include <memory>      // for unique_ptr, shared_ptr, make_unique, allo...
@@ -1438,6 +1439,103 @@ TEST_CASE("as_writeable_bytes")
     }
 }
 
+TEST_CASE("as_span")
+{
+    struct record
+    {
+        std::int32_t id;
+        std::int16_t flags;
+        std::int16_t length;
+    };
+
+    alignas(record) byte storage[3 * sizeof(record)] = {};
+    const span<byte> bytes = storage;
+
+    {
+        const auto records = as_writeable_span<record>(bytes);
+        CHECK(records.size() == 3);
+        CHECK(static_cast<void*>(records.data()) == static_cast<void*>(storage));
+        records[1].id = 42;
+        records[2].length = 7;
+
+        const auto view = as_span<record>(span<const byte>(bytes));
+        CHECK(view[1].id == 42);
+        CHECK(view[2].length == 7);
+
+        // non-const byte spans can be viewed as const records as well
+        CHECK(as_span<record>(bytes).size() == 3);
+    }
+
+    {
+        const span<byte, sizeof(storage)> fixed = storage;
+        const auto records = as_span<record>(fixed);
+        static_assert(std::is_same<decltype(records), const span<const record, 3>>::value,
+                      "the extent is preserved");
+        CHECK(records.size() == 3);
+
+        // round trip
+        CHECK(as_bytes(records).data() == fixed.data());
+    }
+
+    {
+        const auto empty = as_span<record>(span<const byte>());
+        CHECK(empty.empty());
+    }
+
+    // size must be a multiple of the element size
+    CHECK_THROWS_AS(as_span<record>(bytes.first(7)), fail_fast);
+    CHECK_THROWS_AS(as_writeable_span<record>(bytes.first(9)), fail_fast);
+
+    // data must be aligned
+    CHECK_THROWS_AS(as_span<record>(bytes.subspan(1, 8)), fail_fast);
+    CHECK_THROWS_AS(as_writeable_span<std::int32_t>(bytes.subspan(2, 4)), fail_fast);
+
+#ifdef CONFIRM_COMPILATION_ERRORS
+    // not a multiple of the element size
+    as_span<record>(span<byte, 7>(storage, 7));
+    // can not write through const bytes
+    as_writeable_span<record>(span<const byte>(bytes));
+#endif
+}
+
+TEST_CASE("unaligned_span")
+{
+    byte storage[1 + 3 * sizeof(std::uint32_t)] = {};
+    const auto bytes = span<byte>(storage).subspan(1);
+
+    const auto values = as_writeable_unaligned_span<std::uint32_t>(bytes);
+    CHECK(values.size() == 3);
+    values.store(0, 0x01020304u);
+    values.store(2, 0xdeadbeefu);
+    CHECK(values[0] == 0x01020304u);
+    CHECK(values.load(1) == 0u);
+    CHECK(values[2] == 0xdeadbeefu);
+    CHECK_THROWS_AS(values[3], fail_fast);
+    CHECK_THROWS_AS(values.store(-1, 0u), fail_fast);
+
+    const auto view = as_unaligned_span<std::uint32_t>(span<const byte>(bytes));
+    CHECK(view.size() == 3);
+    CHECK(view[2] == 0xdeadbeefu);
+    CHECK(view.bytes().data() == storage + 1);
+
+    const auto tail = view.subspan(1);
+    CHECK(tail.size() == 2);
+    CHECK(tail[1] == 0xdeadbeefu);
+    CHECK(view.subspan(1, 1).size() == 1);
+    CHECK(view.subspan(3).empty());
+    CHECK_THROWS_AS(view.subspan(4), fail_fast);
+    CHECK_THROWS_AS(view.subspan(1, 3), fail_fast);
+
+    CHECK_THROWS_AS(as_unaligned_span<std::uint32_t>(bytes.first(5)), fail_fast);
+
+    const unaligned_span<const std::uint32_t> empty;
+    CHECK(empty.empty());
+
+#ifdef CONFIRM_COMPILATION_ERRORS
+    view.store(0, 1u);
+#endif
+}
+
 GSL_SUPPRESS(con.4) // NO-FORMAT: attribute
 TEST_CASE("fixed_size_conversions")
 {
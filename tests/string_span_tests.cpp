@@ -171,6 +171,100 @@ TEST_CASE("TestToBasicString")
     CHECK(s2.length() == 5);
 }
 
+namespace
+{
+// an allocator with state, to check that the instance passed in is the one used
+template <class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    explicit counting_allocator(int* allocations) noexcept : allocations_(allocations) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept
+        : allocations_(other.allocations_)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        ++*allocations_;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept { std::allocator<T>{}.deallocate(p, n); }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept
+    {
+        return allocations_ == other.allocations_;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    int* allocations_;
+};
+} // namespace
+
+GSL_SUPPRESS(con.4) // NO-FORMAT: attribute
+TEST_CASE("TestToBasicStringWithAllocator")
+{
+    int allocations = 0;
+    const counting_allocator<char> alloc(&allocations);
+
+    const char text[] = "a string too long for the small string buffer";
+    const cstring_span<> v = text;
+    const auto s = gsl::to_basic_string(v, alloc);
+    CHECK(s == text);
+    CHECK(s.get_allocator() == alloc);
+    CHECK(allocations == 1);
+
+    char stack_string[] = "Hello";
+    const string_span<> w = stack_string;
+    const auto s2 = gsl::to_basic_string(w, alloc);
+    CHECK(s2 == "Hello");
+}
+
+GSL_SUPPRESS(con.4) // NO-FORMAT: attribute
+TEST_CASE("TestAssignToAndAppendTo")
+{
+    std::string scratch;
+    scratch.reserve(64);
+    const auto data = scratch.data();
+
+    const char first[] = "Hello";
+    const char second[] = ", World";
+    gsl::assign_to(scratch, cstring_span<>(first));
+    CHECK(scratch == "Hello");
+    gsl::append_to(scratch, cstring_span<>(second));
+    CHECK(scratch == "Hello, World");
+
+    // assigning again reuses the capacity
+    char stack_string[] = "Goodbye";
+    CHECK(&gsl::assign_to(scratch, string_span<>(stack_string)) == &scratch);
+    CHECK(scratch == "Goodbye");
+    CHECK(scratch.data() == data);
+
+    gsl::assign_to(scratch, cstring_span<>{});
+    CHECK(scratch.empty());
+    CHECK(scratch.data() == data);
+
+    // from a view of the string itself
+    scratch = "Hello";
+    gsl::append_to(scratch, cstring_span<>(scratch.data(), 3));
+    CHECK(scratch == "HelloHel");
+    gsl::assign_to(scratch, cstring_span<>(scratch.data() + 5, 3));
+    CHECK(scratch == "Hel");
+
+    std::wstring wide;
+    gsl::append_to(wide, cwstring_span<>(L"wide"));
+    CHECK(wide == L"wide");
+}
+
 GSL_SUPPRESS(con.4) // NO-FORMAT: attribute
 GSL_SUPPRESS(bounds.3) // NO-FORMAT: attribute
 TEST_CASE("EqualityAndImplicitConstructors")
@@ -1231,3 +1325,130 @@ TEST_CASE("as_writeable_bytes")
     CHECK(static_cast<const void*>(bs.data()) == static_cast<const void*>(s.data()));
     CHECK(bs.size() == s.size_bytes());
 }
+
+TEST_CASE("constant_time_equal")
+{
+    const char token[] = "0123456789abcdef0123456789abcdef";
+    const char other[] = "0123456789abcdef0123456789abcdeF";
+    const cstring_span<> t = token;
+
+    CHECK(constant_time_equal(t, cstring_span<>(token)));
+    CHECK(constant_time_equal(t, std::string(token)));
+    CHECK(constant_time_equal(t, token));
+    CHECK(!constant_time_equal(t, other));
+    CHECK(!constant_time_equal(t, "0123456789abcdef"));
+    CHECK(!constant_time_equal(t, cstring_span<>{}));
+
+    char stack_string[] = "secret";
+    const string_span<> s = stack_string;
+    CHECK(constant_time_equal(s, "secret"));
+    CHECK(!constant_time_equal(s, "secreT"));
+
+    const cwstring_span<> w = L"wide secret";
+    CHECK(constant_time_equal(w, L"wide secret"));
+    CHECK(!constant_time_equal(w, L"wide secreT"));
+}
+
+TEST_CASE("character_classes")
+{
+    CHECK(is_space(' '));
+    CHECK(is_space('\t'));
+    CHECK(is_space('\n'));
+    CHECK(is_space('\v'));
+    CHECK(is_space('\f'));
+    CHECK(is_space('\r'));
+    CHECK(!is_space('\b'));
+    CHECK(!is_space('\x0e'));
+    CHECK(!is_space('x'));
+    CHECK(!is_space(static_cast<char>(0xa0)));
+    CHECK(is_space(L' '));
+
+    CHECK(is_digit('0'));
+    CHECK(is_digit('9'));
+    CHECK(!is_digit('a'));
+    CHECK(is_alpha('q'));
+    CHECK(is_alpha('Q'));
+    CHECK(!is_alpha('['));
+    CHECK(!is_alpha(static_cast<char>(0xe9)));
+    CHECK(is_alnum('7'));
+    CHECK(!is_alnum('_'));
+    CHECK(is_hex_digit('F'));
+    CHECK(is_hex_digit('a'));
+    CHECK(!is_hex_digit('g'));
+    CHECK(is_hex_digit(u'5'));
+}
+
+TEST_CASE("trim")
+{
+    const cstring_span<> s = "  \t key = value \r\n";
+    CHECK(trim_left(s) == "key = value \r\n");
+    CHECK(trim_right(s) == "  \t key = value");
+    CHECK(trim(s) == "key = value");
+    CHECK(trim(s).data() == s.data() + 4);
+
+    CHECK(trim(cstring_span<>{}).empty());
+    CHECK(trim(cstring_span<>(" \t\n")).empty());
+    CHECK(trim(cstring_span<>("x")) == "x");
+
+    // long padded fields, including runs that end in the middle of a word
+    for (const std::ptrdiff_t left : {0, 1, 7, 8, 9, 16, 23, 40})
+    {
+        for (const std::ptrdiff_t right : {0, 1, 8, 15, 33})
+        {
+            std::string padded(static_cast<std::size_t>(left), ' ');
+            if (left > 2) padded[1] = '\t';
+            padded += "field\xa0value";
+            padded.append(static_cast<std::size_t>(right), right % 2 ? '\n' : ' ');
+            const cstring_span<> field = padded;
+            CHECK(trim_left(field).size() == field.size() - left);
+            CHECK(trim_right(field).size() == field.size() - right);
+            CHECK(trim(field) == "field\xa0value");
+        }
+    }
+
+    // a word that is whitespace but for one byte
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        std::string padded(16, ' ');
+        padded[i] = '\x0e';
+        const cstring_span<> field = padded;
+        CHECK(trim_left(field).size() == narrow_cast<std::ptrdiff_t>(16 - i));
+        CHECK(trim_right(field).size() == narrow_cast<std::ptrdiff_t>(i + 1));
+    }
+
+    char stack_string[] = " mutable ";
+    const string_span<> m = stack_string;
+    const string_span<> trimmed = trim(m);
+    trimmed[0] = 'M';
+    CHECK(m == " Mutable ");
+
+    const cwstring_span<> w = L"\t wide\n";
+    CHECK(trim(w) == L"wide");
+}
+
+TEST_CASE("trim_with_predicate")
+{
+    const cstring_span<> s = "000120";
+    const auto is_zero = [](char c) { return c == '0'; };
+    CHECK(trim_left(s, is_zero) == "120");
+    CHECK(trim_right(s, is_zero) == "00012");
+    CHECK(trim(s, is_zero) == "12");
+    CHECK(trim(cstring_span<>("0000"), is_zero).empty());
+    CHECK(trim_left(cstring_span<>("abc123"), is_alpha<char>) == "123");
+    CHECK(trim_right(cstring_span<>("abc123"), is_digit<char>) == "abc");
+}
+
+TEST_CASE("is_blank")
+{
+    CHECK(is_blank(cstring_span<>{}));
+    CHECK(is_blank(cstring_span<>(" \t\r\n\v\f")));
+    CHECK(!is_blank(cstring_span<>("  .  ")));
+
+    std::string padded(64, ' ');
+    CHECK(is_blank(cstring_span<>(padded)));
+    padded[61] = '-';
+    CHECK(!is_blank(cstring_span<>(padded)));
+
+    CHECK(is_blank(cwstring_span<>(L" \t")));
+    CHECK(!is_blank(cwstring_span<>(L" x")));
+}